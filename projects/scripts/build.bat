@@ -17,7 +17,7 @@ PROJECT_VERSION=1.0 ^
 PROJECT_DESCRIPTION="" ^
 PROJECT_INTERNAL_NAME=maze_game ^
 PROJECT_PLATFORM=PLATFORM_DESKTOP ^
-PROJECT_SOURCE_FILES="maze_game.c" ^
+PROJECT_SOURCE_FILES="maze_game.c maze.c maze_tiles.c maze_view.c maze_path.c job_pool.c file_map.c maze_file.c maze_items.c maze_sim.c maze_replay.c frame_profiler.c asset_loader.c resource_pack.c maze_swarm.c maze_stream.c maze_model.c maze_journal.c" ^
 BUILD_MODE="RELEASE" ^
 BUILD_WEB_ASYNCIFY=FALSE ^
 BUILD_WEB_MIN_SHELL=TRUE ^
@@ -0,0 +1,184 @@
+/*******************************************************************************************
+*
+*   raylib maze game - asset loader module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "asset_loader.h"
+
+#include "job_pool.h"       // Required for: StartJobTask(), IsJobTaskDone(), WaitJobTask()
+#include "resource_pack.h"  // Required for: LoadResourcePack(), GetResourcePackFile()
+
+#include <stdio.h>          // Required for: snprintf()
+#include <stdlib.h>         // Required for: calloc(), free()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Asset loader state
+// NOTE: Assets decoded data is only written by worker thread until task is done,
+// then it is only accessed by main thread
+struct AssetLoader {
+    const char *directory;      // Assets directory, for files not found in pack
+    const char *packFileName;   // Resource pack file name
+    Asset *assets;              // Assets to load, owned by user
+    int assetCount;             // Assets count
+    int uploadedCount;          // Assets uploaded on main thread
+    JobTask *task;              // Worker thread task, NULL once finished
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void LoadAssetsJob(void *data, int index);           // Read and decode all assets files, worker thread job
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load asset loader, worker thread starts reading and decoding assets
+AssetLoader *LoadAssetLoader(const char *directory, const char *packFileName, Asset *assets, int assetCount)
+{
+    AssetLoader *loader = (AssetLoader *)calloc(1, sizeof(AssetLoader));
+
+    if (loader == NULL) return NULL;
+
+    loader->directory = directory;
+    loader->packFileName = packFileName;
+    loader->assets = assets;
+    loader->assetCount = assetCount;
+
+    for (int i = 0; i < assetCount; i++) assets[i].loaded = false;
+
+    loader->task = StartJobTask(LoadAssetsJob, loader);
+
+    return loader;
+}
+
+// Unload asset loader, waiting for worker thread (loaded assets are not unloaded)
+// NOTE: Decoded assets not uploaded yet (loading cancelled) are unloaded
+void UnloadAssetLoader(AssetLoader *loader)
+{
+    if (loader == NULL) return;
+
+    WaitJobTask(loader->task);
+
+    for (int i = 0; i < loader->assetCount; i++)
+    {
+        Asset *asset = &loader->assets[i];
+
+        if (asset->loaded) continue;
+
+        UnloadImage(asset->image);
+        UnloadWave(asset->wave);
+        asset->image = (Image){ 0 };
+        asset->wave = (Wave){ 0 };
+        asset->loaded = true;
+    }
+
+    free(loader);
+}
+
+// Update asset loader, uploading decoded assets on main thread, returns true when finished
+// NOTE: Uploads are limited per call, so loading state frames keep a stable frame time
+bool UpdateAssetLoader(AssetLoader *loader, int maxUploads)
+{
+    if (loader == NULL) return true;
+
+    if (loader->task != NULL)
+    {
+        if (!IsJobTaskDone(loader->task)) return false;
+
+        WaitJobTask(loader->task);
+        loader->task = NULL;
+    }
+
+    for (int uploads = 0; (loader->uploadedCount < loader->assetCount) && (uploads < maxUploads); uploads++)
+    {
+        Asset *asset = &loader->assets[loader->uploadedCount];
+
+        if ((asset->type == ASSET_TEXTURE) && (asset->image.data != NULL))
+        {
+            asset->texture = LoadTextureFromImage(asset->image);
+            UnloadImage(asset->image);
+            asset->image = (Image){ 0 };
+        }
+        else if ((asset->type == ASSET_SOUND) && (asset->wave.data != NULL))
+        {
+            asset->sound = LoadSoundFromWave(asset->wave);
+            UnloadWave(asset->wave);
+            asset->wave = (Wave){ 0 };
+        }
+        else TraceLog(LOG_WARNING, "ASSETS: [%s] Failed to load asset", asset->fileName);
+
+        asset->loaded = true;
+        loader->uploadedCount++;
+    }
+
+    return (loader->uploadedCount == loader->assetCount);
+}
+
+// Get asset loader progress [0..1]
+// NOTE: Worker thread reading and decoding is counted as first half of loading
+float GetAssetLoaderProgress(AssetLoader *loader)
+{
+    if ((loader == NULL) || (loader->assetCount == 0)) return 1.0f;
+    if ((loader->task != NULL) && !IsJobTaskDone(loader->task)) return 0.0f;
+
+    return 0.5f + 0.5f*(float)loader->uploadedCount/loader->assetCount;
+}
+
+// Unload loaded assets textures and sounds
+void UnloadAssets(Asset *assets, int assetCount)
+{
+    for (int i = 0; i < assetCount; i++)
+    {
+        if (assets[i].texture.id > 0) UnloadTexture(assets[i].texture);
+        if (assets[i].sound.frameCount > 0) UnloadSound(assets[i].sound);
+
+        assets[i].texture = (Texture){ 0 };
+        assets[i].sound = (Sound){ 0 };
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Read and decode all assets files, worker thread job
+// NOTE: Resource pack is read at once, assets missing from pack are read from directory,
+// TextFormat() is not used, its internal buffers are shared with main thread
+static void LoadAssetsJob(void *data, int index)
+{
+    AssetLoader *loader = (AssetLoader *)data;
+    ResourcePack pack = LoadResourcePack(loader->packFileName);
+
+    for (int i = 0; i < loader->assetCount; i++)
+    {
+        Asset *asset = &loader->assets[i];
+        int dataSize = 0;
+        const unsigned char *fileData = GetResourcePackFile(pack, asset->fileName, &dataSize);
+        unsigned char *loadedData = NULL;
+
+        if (fileData == NULL)
+        {
+            char filePath[512] = { 0 };
+            snprintf(filePath, sizeof(filePath), "%s/%s", loader->directory, asset->fileName);
+
+            loadedData = LoadFileData(filePath, &dataSize);
+            fileData = loadedData;
+        }
+
+        if (fileData != NULL)
+        {
+            if (asset->type == ASSET_TEXTURE) asset->image = LoadImageFromMemory(GetFileExtension(asset->fileName), fileData, dataSize);
+            else if (asset->type == ASSET_SOUND) asset->wave = LoadWaveFromMemory(GetFileExtension(asset->fileName), fileData, dataSize);
+        }
+
+        UnloadFileData(loadedData);
+    }
+
+    UnloadResourcePack(pack);
+
+    (void)index;
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************************
+*
+*   raylib maze game - asset loader module
+*
+*   Asynchronous assets loading: files reading and decoding (images and waves) is done on
+*   a background worker thread, while main thread keeps rendering a loading state, then
+*   GPU textures and audio sounds are created on main thread, a few assets per frame
+*
+*   Asset files are read from a resource pack if available (one sequential read for all
+*   assets), assets not found in the pack are read from the assets directory
+*
+*   NOTE: Only CPU-side raylib functionality is used by worker thread, graphics and
+*   audio device resources are always created by thread calling UpdateAssetLoader()
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "raylib.h"
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Asset types
+typedef enum {
+    ASSET_TEXTURE = 0,          // Image file, uploaded as GPU texture
+    ASSET_SOUND                 // Wave file, loaded as audio sound
+} AssetType;
+
+// Asset, requested file and loaded resource
+// NOTE: Image and wave are only valid while loading, they are unloaded once uploaded
+typedef struct Asset {
+    const char *fileName;       // Asset file name, also resource pack entry name
+    int type;                   // Asset type (AssetType)
+    Image image;                // Decoded image (ASSET_TEXTURE), set by worker thread
+    Wave wave;                  // Decoded wave (ASSET_SOUND), set by worker thread
+    Texture texture;            // Loaded texture (ASSET_TEXTURE), id is 0 if not loaded
+    Sound sound;                // Loaded sound (ASSET_SOUND), frameCount is 0 if not loaded
+    bool loaded;                // Asset loaded (uploaded or failed)
+} Asset;
+
+// Asset loader, opaque type
+typedef struct AssetLoader AssetLoader;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+AssetLoader *LoadAssetLoader(const char *directory, const char *packFileName, Asset *assets, int assetCount); // Load asset loader, worker thread starts reading and decoding assets
+void UnloadAssetLoader(AssetLoader *loader);                // Unload asset loader, waiting for worker thread (loaded assets are not unloaded)
+bool UpdateAssetLoader(AssetLoader *loader, int maxUploads); // Update asset loader, uploading decoded assets on main thread, returns true when finished
+float GetAssetLoaderProgress(AssetLoader *loader);          // Get asset loader progress [0..1]
+void UnloadAssets(Asset *assets, int assetCount);           // Unload loaded assets textures and sounds
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // ASSET_LOADER_H
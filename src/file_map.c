@@ -0,0 +1,113 @@
+/*******************************************************************************************
+*
+*   raylib maze game - memory-mapped files module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "file_map.h"
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>        // Required for: CreateFileA(), CreateFileMappingA(), MapViewOfFile()
+#elif !defined(PLATFORM_WEB)
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+#else
+    #include <stdio.h>          // Required for: fopen(), fread(), fclose()
+    #include <stdlib.h>         // Required for: malloc(), free()
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load memory-mapped file (read-only), data is NULL on failure
+// NOTE: Empty files can not be mapped
+MappedFile LoadMappedFile(const char *fileName)
+{
+    MappedFile file = { 0 };
+
+#if defined(_WIN32)
+    HANDLE fileHandle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (fileHandle == INVALID_HANDLE_VALUE) return file;
+
+    LARGE_INTEGER fileSize = { 0 };
+
+    if (GetFileSizeEx(fileHandle, &fileSize) && (fileSize.QuadPart > 0))
+    {
+        HANDLE mapping = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        if (mapping != NULL)
+        {
+            // NOTE: Mapped view keeps the file mapping alive, handles can be closed
+            file.data = (const unsigned char *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (file.data != NULL) file.size = (size_t)fileSize.QuadPart;
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(fileHandle);
+#elif !defined(PLATFORM_WEB)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd < 0) return file;
+
+    struct stat fileStat = { 0 };
+
+    if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0))
+    {
+        void *data = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data != MAP_FAILED)
+        {
+            file.data = (const unsigned char *)data;
+            file.size = (size_t)fileStat.st_size;
+        }
+    }
+
+    // NOTE: Mapping keeps the file referenced, descriptor can be closed
+    close(fd);
+#else
+    FILE *fileHandle = fopen(fileName, "rb");
+
+    if (fileHandle == NULL) return file;
+
+    fseek(fileHandle, 0, SEEK_END);
+    long size = ftell(fileHandle);
+    fseek(fileHandle, 0, SEEK_SET);
+
+    if (size > 0)
+    {
+        unsigned char *data = (unsigned char *)malloc(size);
+
+        if ((data != NULL) && (fread(data, 1, size, fileHandle) == (size_t)size))
+        {
+            file.data = data;
+            file.size = (size_t)size;
+        }
+        else free(data);
+    }
+
+    fclose(fileHandle);
+#endif
+
+    return file;
+}
+
+// Unload memory-mapped file
+void UnloadMappedFile(MappedFile file)
+{
+    if (file.data == NULL) return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(file.data);
+#elif !defined(PLATFORM_WEB)
+    munmap((void *)file.data, file.size);
+#else
+    free((void *)file.data);
+#endif
+}
@@ -0,0 +1,46 @@
+/*******************************************************************************************
+*
+*   raylib maze game - memory-mapped files module
+*
+*   Maps a file into memory, read-only, so its data can be used in place without copies,
+*   only the pages actually accessed are read from disk
+*
+*   Mapping backend: Win32 file mapping on Windows, mmap() on other platforms,
+*   PLATFORM_WEB reads the whole file into memory
+*
+*   NOTE: This module does not depend on raylib, so it can be included along with
+*   platform headers (windows.h defines symbols that collide with raylib.h)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef FILE_MAP_H
+#define FILE_MAP_H
+
+#include <stddef.h>     // Required for: size_t
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Memory-mapped file, read-only
+typedef struct MappedFile {
+    const unsigned char *data;  // File data, NULL if file could not be mapped
+    size_t size;                // File size in bytes
+} MappedFile;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MappedFile LoadMappedFile(const char *fileName);            // Load memory-mapped file (read-only), data is NULL on failure
+void UnloadMappedFile(MappedFile file);                     // Unload memory-mapped file
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // FILE_MAP_H
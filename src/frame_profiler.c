@@ -0,0 +1,252 @@
+/*******************************************************************************************
+*
+*   raylib maze game - frame profiler module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "frame_profiler.h"
+
+#include <stdio.h>      // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>     // Required for: calloc(), free(), qsort()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Frames counter atomic access, release on writing, acquire on reading
+#if defined(_MSC_VER)
+    #include <intrin.h>     // Required for: _ReadWriteBarrier()
+    // NOTE: MSVC volatile accesses have acquire/release semantics (/volatile:ms, default on x86/x64)
+    #define PROFILER_STORE_RELEASE(ptr, value)  do { _ReadWriteBarrier(); *(volatile unsigned int *)(ptr) = (value); } while (0)
+    #define PROFILER_LOAD_ACQUIRE(ptr)          (*(volatile const unsigned int *)(ptr))
+#else
+    #define PROFILER_STORE_RELEASE(ptr, value)  __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #define PROFILER_LOAD_ACQUIRE(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif
+
+#define PROFILER_GRAPH_FRAMES       160     // Overlay graph frames, 2 pixels per frame
+#define PROFILER_GRAPH_HEIGHT       60      // Overlay graph height, two 60 fps frames (33.3 ms)
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int CompareFrameTimes(const void *a, const void *b);         // Compare frame times for sorting
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load frame profiler for a set of phases
+// NOTE: Phases names are not copied, they must remain valid while profiler is used
+FrameProfiler LoadFrameProfiler(const char **phaseNames, int phaseCount)
+{
+    FrameProfiler profiler = { 0 };
+
+    if (phaseCount > PROFILER_MAX_PHASES) phaseCount = PROFILER_MAX_PHASES;
+
+    profiler.records = (float *)calloc(PROFILER_MAX_FRAMES*(phaseCount + 1), sizeof(float));
+    if (profiler.records == NULL) return profiler;
+
+    profiler.phaseCount = phaseCount;
+    for (int i = 0; i < phaseCount; i++) profiler.phaseNames[i] = phaseNames[i];
+
+    return profiler;
+}
+
+// Unload frame profiler
+void UnloadFrameProfiler(FrameProfiler *profiler)
+{
+    free(profiler->records);
+    profiler->records = NULL;
+    profiler->phaseCount = 0;
+}
+
+// Begin frame timing, current frame phases times reset
+void BeginProfilerFrame(FrameProfiler *profiler)
+{
+    for (int i = 0; i < profiler->phaseCount; i++) profiler->phaseTimes[i] = 0.0f;
+
+    profiler->frameStartTime = GetTime();
+}
+
+// End frame timing, frame record stored in ring buffer
+// NOTE: Record is written before publishing the new frames count
+void EndProfilerFrame(FrameProfiler *profiler)
+{
+    if (profiler->records == NULL) return;
+
+    unsigned int frame = profiler->frameCount;
+    float *record = profiler->records + (frame & (PROFILER_MAX_FRAMES - 1))*(profiler->phaseCount + 1);
+
+    for (int i = 0; i < profiler->phaseCount; i++) record[i] = profiler->phaseTimes[i];
+    record[profiler->phaseCount] = (float)((GetTime() - profiler->frameStartTime)*1000.0);
+
+    PROFILER_STORE_RELEASE(&profiler->frameCount, frame + 1);
+}
+
+// Begin phase timing
+void BeginProfilerPhase(FrameProfiler *profiler, int phase)
+{
+    if ((phase >= 0) && (phase < profiler->phaseCount)) profiler->phaseStartTimes[phase] = GetTime();
+}
+
+// End phase timing, time added to current frame phase
+void EndProfilerPhase(FrameProfiler *profiler, int phase)
+{
+    if ((phase >= 0) && (phase < profiler->phaseCount)) profiler->phaseTimes[phase] += (float)((GetTime() - profiler->phaseStartTimes[phase])*1000.0);
+}
+
+// Add time (seconds) to current frame phase, negative to remove
+// NOTE: Useful to move time measured inside a phase to another phase
+void AddProfilerPhaseTime(FrameProfiler *profiler, int phase, double time)
+{
+    if ((phase >= 0) && (phase < profiler->phaseCount)) profiler->phaseTimes[phase] += (float)(time*1000.0);
+}
+
+// Get phase stats for last frames, phaseCount for total frame time
+// NOTE: Frames are limited to PROFILER_MAX_FRAMES - 1, so writer is always one record ahead
+ProfilerStats GetProfilerStats(const FrameProfiler *profiler, int phase, int frames)
+{
+    ProfilerStats stats = { 0 };
+
+    if ((profiler->records == NULL) || (phase < 0) || (phase > profiler->phaseCount)) return stats;
+
+    unsigned int frameCount = PROFILER_LOAD_ACQUIRE(&profiler->frameCount);
+
+    if (frames > (PROFILER_MAX_FRAMES - 1)) frames = PROFILER_MAX_FRAMES - 1;
+    if ((unsigned int)frames > frameCount) frames = (int)frameCount;
+    if (frames <= 0) return stats;
+
+    float times[PROFILER_MAX_FRAMES] = { 0 };
+    float total = 0.0f;
+
+    for (int i = 0; i < frames; i++)
+    {
+        unsigned int frame = frameCount - frames + i;
+        times[i] = profiler->records[(frame & (PROFILER_MAX_FRAMES - 1))*(profiler->phaseCount + 1) + phase];
+        total += times[i];
+    }
+
+    qsort(times, frames, sizeof(float), CompareFrameTimes);
+
+    stats.min = times[0];
+    stats.avg = total/frames;
+    stats.p99 = times[(frames*99 + 99)/100 - 1];
+    stats.max = times[frames - 1];
+
+    return stats;
+}
+
+// Draw profiler overlay: phases stats and frame times graph
+// NOTE: Graph shows last frames, phases stacked with same colors used for phases names
+void DrawFrameProfiler(const FrameProfiler *profiler, int posX, int posY)
+{
+    const Color phaseColors[8] = { SKYBLUE, ORANGE, RED, LIME, VIOLET, GOLD, PINK, BEIGE };
+
+    if (profiler->records == NULL) return;
+
+    int rowCount = profiler->phaseCount + 1;
+    int width = 2*PROFILER_GRAPH_FRAMES + 16;
+    int height = 34 + rowCount*14 + PROFILER_GRAPH_HEIGHT + 8;
+
+    DrawRectangle(posX, posY, width, height, Fade(BLACK, 0.75f));
+    DrawText(TextFormat("PROFILER - LAST %i FRAMES (ms)", PROFILER_STATS_FRAMES), posX + 8, posY + 6, 10, WHITE);
+
+    int textY = posY + 20;
+    DrawText("PHASE", posX + 8, textY, 10, GRAY);
+    DrawText("MIN", posX + 110, textY, 10, GRAY);
+    DrawText("AVG", posX + 160, textY, 10, GRAY);
+    DrawText("P99", posX + 210, textY, 10, GRAY);
+    DrawText("MAX", posX + 260, textY, 10, GRAY);
+
+    for (int i = 0; i < rowCount; i++)
+    {
+        ProfilerStats stats = GetProfilerStats(profiler, i, PROFILER_STATS_FRAMES);
+        Color color = (i < profiler->phaseCount)? phaseColors[i%8] : WHITE;
+
+        textY += 14;
+        DrawText((i < profiler->phaseCount)? profiler->phaseNames[i] : "frame", posX + 8, textY, 10, color);
+        DrawText(TextFormat("%.2f", stats.min), posX + 110, textY, 10, color);
+        DrawText(TextFormat("%.2f", stats.avg), posX + 160, textY, 10, color);
+        DrawText(TextFormat("%.2f", stats.p99), posX + 210, textY, 10, color);
+        DrawText(TextFormat("%.2f", stats.max), posX + 260, textY, 10, color);
+    }
+
+    // Frame times graph, stacked phases, one 60 fps frame time reference line
+    unsigned int frameCount = PROFILER_LOAD_ACQUIRE(&profiler->frameCount);
+    int graphX = posX + 8;
+    int graphBottom = posY + height - 8;
+    float pixelsPerMs = PROFILER_GRAPH_HEIGHT/(2000.0f/60.0f);
+
+    for (int i = 0; i < PROFILER_GRAPH_FRAMES; i++)
+    {
+        if ((unsigned int)(PROFILER_GRAPH_FRAMES - i) > frameCount) continue;
+
+        unsigned int frame = frameCount - PROFILER_GRAPH_FRAMES + i;
+        const float *record = profiler->records + (frame & (PROFILER_MAX_FRAMES - 1))*(profiler->phaseCount + 1);
+        float barY = (float)graphBottom;
+
+        for (int p = 0; p < profiler->phaseCount; p++)
+        {
+            float barHeight = record[p]*pixelsPerMs;
+            if ((graphBottom - (barY - barHeight)) > PROFILER_GRAPH_HEIGHT) barHeight = barY - (graphBottom - PROFILER_GRAPH_HEIGHT);
+            if (barHeight <= 0.0f) continue;
+
+            barY -= barHeight;
+            DrawRectangleRec((Rectangle){ (float)(graphX + i*2), barY, 2.0f, barHeight }, phaseColors[p%8]);
+        }
+    }
+
+    DrawLine(graphX, graphBottom - PROFILER_GRAPH_HEIGHT/2, graphX + 2*PROFILER_GRAPH_FRAMES, graphBottom - PROFILER_GRAPH_HEIGHT/2, Fade(WHITE, 0.5f));
+}
+
+// Export stored frame records as CSV
+// NOTE: One row per frame (oldest first), phases times and total frame time in milliseconds
+bool ExportFrameProfiler(const FrameProfiler *profiler, const char *fileName)
+{
+    if (profiler->records == NULL) return false;
+
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "PROFILER: [%s] Failed to save profiler data", fileName);
+        return false;
+    }
+
+    unsigned int frameCount = PROFILER_LOAD_ACQUIRE(&profiler->frameCount);
+    unsigned int frames = (frameCount < (PROFILER_MAX_FRAMES - 1))? frameCount : (PROFILER_MAX_FRAMES - 1);
+
+    fprintf(file, "frame");
+    for (int p = 0; p < profiler->phaseCount; p++) fprintf(file, ",%s", profiler->phaseNames[p]);
+    fprintf(file, ",total\n");
+
+    for (unsigned int i = 0; i < frames; i++)
+    {
+        unsigned int frame = frameCount - frames + i;
+        const float *record = profiler->records + (frame & (PROFILER_MAX_FRAMES - 1))*(profiler->phaseCount + 1);
+
+        fprintf(file, "%u", frame);
+        for (int p = 0; p <= profiler->phaseCount; p++) fprintf(file, ",%.4f", record[p]);
+        fprintf(file, "\n");
+    }
+
+    bool success = (fclose(file) == 0);
+
+    if (success) TraceLog(LOG_INFO, "PROFILER: [%s] Profiler data saved successfully (%u frames)", fileName, frames);
+    else TraceLog(LOG_WARNING, "PROFILER: [%s] Failed to save profiler data", fileName);
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Compare frame times for sorting
+static int CompareFrameTimes(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
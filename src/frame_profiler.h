@@ -0,0 +1,81 @@
+/*******************************************************************************************
+*
+*   raylib maze game - frame profiler module
+*
+*   Lightweight per-phase frame timing: main loop phases are timed with Begin/End pairs
+*   (phases can be timed several times per frame, times are accumulated) and every frame
+*   record (phases times and total frame time) is stored in a ring buffer, keeping the
+*   last PROFILER_MAX_FRAMES frames
+*
+*   Ring buffer is lock-free, single writer: frame records are written by the thread
+*   calling EndProfilerFrame() and published with a release store of the frames counter,
+*   so records can be read by other threads without blocking the main loop
+*
+*   Frames stats (min, avg, p99, max) can be drawn as an overlay and records exported as CSV
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include "raylib.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PROFILER_MAX_PHASES         16      // Maximum profiled phases
+#define PROFILER_MAX_FRAMES         512     // Frame records ring buffer capacity (power of two)
+#define PROFILER_STATS_FRAMES       240     // Frames used for overlay stats
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Profiler phase stats, in milliseconds
+typedef struct ProfilerStats {
+    float min;                  // Minimum time
+    float avg;                  // Average time
+    float p99;                  // Percentile 99 time
+    float max;                  // Maximum time
+} ProfilerStats;
+
+// Frame profiler
+// NOTE: Every frame record stores phaseCount phases times plus total frame time (ms)
+typedef struct FrameProfiler {
+    int phaseCount;                                 // Profiled phases count
+    const char *phaseNames[PROFILER_MAX_PHASES];    // Phases names
+    double frameStartTime;                          // Current frame start time
+    double phaseStartTimes[PROFILER_MAX_PHASES];    // Current frame phases start times
+    float phaseTimes[PROFILER_MAX_PHASES];          // Current frame phases accumulated times (ms)
+    float *records;                                 // Frame records ring buffer (PROFILER_MAX_FRAMES)
+    unsigned int frameCount;                        // Recorded frames count, published to readers
+} FrameProfiler;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+FrameProfiler LoadFrameProfiler(const char **phaseNames, int phaseCount);   // Load frame profiler for a set of phases
+void UnloadFrameProfiler(FrameProfiler *profiler);                  // Unload frame profiler
+
+// Frame and phases timing
+void BeginProfilerFrame(FrameProfiler *profiler);                   // Begin frame timing, current frame phases times reset
+void EndProfilerFrame(FrameProfiler *profiler);                     // End frame timing, frame record stored in ring buffer
+void BeginProfilerPhase(FrameProfiler *profiler, int phase);        // Begin phase timing
+void EndProfilerPhase(FrameProfiler *profiler, int phase);          // End phase timing, time added to current frame phase
+void AddProfilerPhaseTime(FrameProfiler *profiler, int phase, double time); // Add time (seconds) to current frame phase, negative to remove
+
+// Frame records stats and export
+ProfilerStats GetProfilerStats(const FrameProfiler *profiler, int phase, int frames); // Get phase stats for last frames, phaseCount for total frame time
+void DrawFrameProfiler(const FrameProfiler *profiler, int posX, int posY); // Draw profiler overlay: phases stats and frame times graph
+bool ExportFrameProfiler(const FrameProfiler *profiler, const char *fileName); // Export stored frame records as CSV
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // FRAME_PROFILER_H
@@ -0,0 +1,404 @@
+/*******************************************************************************************
+*
+*   raylib maze game - job pool module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "job_pool.h"
+
+#include <stdlib.h>     // Required for: calloc(), free()
+#include <stdbool.h>    // Required for: bool
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>        // Required for: CreateThread(), CRITICAL_SECTION, CONDITION_VARIABLE
+
+    typedef HANDLE JobThread;
+    typedef CRITICAL_SECTION JobMutex;
+    typedef CONDITION_VARIABLE JobCondition;
+
+    #define JOB_THREAD_RESULT DWORD WINAPI
+#elif !defined(PLATFORM_WEB)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_mutex_t, pthread_cond_t
+    #include <unistd.h>         // Required for: sysconf()
+    #include <time.h>           // Required for: clock_gettime()
+
+    typedef pthread_t JobThread;
+    typedef pthread_mutex_t JobMutex;
+    typedef pthread_cond_t JobCondition;
+
+    #define JOB_THREAD_RESULT void *
+#else
+    #include <emscripten.h>     // Required for: emscripten_get_now()
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Job pool state
+// NOTE: Jobs are run in batches, workers wait for a new batch id and take job indices
+// from a shared counter until batch jobs are exhausted
+struct JobPool {
+    int threadCount;                // Threads count, calling thread included
+#if !defined(PLATFORM_WEB)
+    JobThread threads[JOB_POOL_MAX_THREADS];
+    JobMutex mutex;                 // Protects all batch state
+    JobCondition batchStart;        // Signaled when a new batch is available (or pool unloading)
+    JobCondition batchDone;         // Signaled when last batch job is done
+
+    unsigned int batchId;           // Current batch id, incremented on every RunJobs()
+    JobFunc func;                   // Current batch job function
+    void *data;                     // Current batch job data
+    int jobCount;                   // Current batch jobs count
+    int nextJob;                    // Next job index to take
+    int doneCount;                  // Jobs done in current batch
+    bool quit;                      // Workers must exit
+#endif
+};
+
+// Background job task state
+// NOTE: Done flag is protected by mutex, so task results written by the job
+// are visible to the thread checking the flag
+struct JobTask {
+    JobFunc func;                   // Task job function, NULL if task was run synchronously
+    void *data;                     // Task job data
+    bool done;                      // Task job finished
+#if !defined(PLATFORM_WEB)
+    JobThread thread;
+    JobMutex mutex;                 // Protects done flag
+#endif
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+#if !defined(PLATFORM_WEB)
+static void LockJobMutex(JobMutex *mutex);
+static void UnlockJobMutex(JobMutex *mutex);
+static void WaitJobCondition(JobCondition *condition, JobMutex *mutex);
+static void BroadcastJobCondition(JobCondition *condition);
+
+static void RunBatchJobs(JobPool *pool);                    // Take and run current batch jobs until exhausted, mutex must be locked
+static JOB_THREAD_RESULT JobWorker(void *arg);              // Worker thread entry point
+static JOB_THREAD_RESULT JobTaskWorker(void *arg);          // Background task thread entry point
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load job pool, threads count includes calling thread (0 for all CPU cores)
+JobPool *LoadJobPool(int threadCount)
+{
+    if (threadCount <= 0) threadCount = GetCpuCount();
+    if (threadCount > JOB_POOL_MAX_THREADS) threadCount = JOB_POOL_MAX_THREADS;
+
+    JobPool *pool = (JobPool *)calloc(1, sizeof(JobPool));
+
+    if (pool == NULL) return NULL;
+
+    pool->threadCount = 1;
+
+#if defined(_WIN32)
+    InitializeCriticalSection(&pool->mutex);
+    InitializeConditionVariable(&pool->batchStart);
+    InitializeConditionVariable(&pool->batchDone);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        pool->threads[i] = CreateThread(NULL, 0, JobWorker, pool, 0, NULL);
+        if (pool->threads[i] == NULL) break;
+        pool->threadCount++;
+    }
+#elif !defined(PLATFORM_WEB)
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->batchStart, NULL);
+    pthread_cond_init(&pool->batchDone, NULL);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (pthread_create(&pool->threads[i], NULL, JobWorker, pool) != 0) break;
+        pool->threadCount++;
+    }
+#endif
+
+    return pool;
+}
+
+// Unload job pool, waiting for worker threads to finish
+void UnloadJobPool(JobPool *pool)
+{
+    if (pool == NULL) return;
+
+#if !defined(PLATFORM_WEB)
+    LockJobMutex(&pool->mutex);
+    pool->quit = true;
+    BroadcastJobCondition(&pool->batchStart);
+    UnlockJobMutex(&pool->mutex);
+
+    for (int i = 1; i < pool->threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+    #else
+        pthread_join(pool->threads[i], NULL);
+    #endif
+    }
+
+    #if defined(_WIN32)
+    DeleteCriticalSection(&pool->mutex);
+    #else
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->batchStart);
+    pthread_cond_destroy(&pool->batchDone);
+    #endif
+#endif
+
+    free(pool);
+}
+
+// Run jobs [0..jobCount-1] in parallel, returns when all are done (pool can be NULL)
+// NOTE: Jobs run in any order and on any thread, calling thread also runs jobs
+void RunJobs(JobPool *pool, int jobCount, JobFunc func, void *data)
+{
+    if (jobCount <= 0) return;
+
+    if ((pool == NULL) || (pool->threadCount <= 1) || (jobCount == 1))
+    {
+        for (int i = 0; i < jobCount; i++) func(data, i);
+        return;
+    }
+
+#if !defined(PLATFORM_WEB)
+    LockJobMutex(&pool->mutex);
+
+    pool->func = func;
+    pool->data = data;
+    pool->jobCount = jobCount;
+    pool->nextJob = 0;
+    pool->doneCount = 0;
+    pool->batchId++;
+    BroadcastJobCondition(&pool->batchStart);
+
+    RunBatchJobs(pool);
+
+    while (pool->doneCount < pool->jobCount) WaitJobCondition(&pool->batchDone, &pool->mutex);
+
+    UnlockJobMutex(&pool->mutex);
+#endif
+}
+
+// Get job pool threads count (calling thread included)
+int GetJobPoolThreadCount(JobPool *pool)
+{
+    return (pool == NULL)? 1 : pool->threadCount;
+}
+
+// Start background task on a dedicated thread, job function called with index 0
+// NOTE: Task runs on calling thread if thread can not be created (or PLATFORM_WEB)
+JobTask *StartJobTask(JobFunc func, void *data)
+{
+    JobTask *task = (JobTask *)calloc(1, sizeof(JobTask));
+
+    if (task == NULL)
+    {
+        func(data, 0);
+        return NULL;
+    }
+
+    task->func = func;
+    task->data = data;
+
+#if defined(_WIN32)
+    InitializeCriticalSection(&task->mutex);
+    task->thread = CreateThread(NULL, 0, JobTaskWorker, task, 0, NULL);
+    if (task->thread != NULL) return task;
+    DeleteCriticalSection(&task->mutex);
+#elif !defined(PLATFORM_WEB)
+    pthread_mutex_init(&task->mutex, NULL);
+    if (pthread_create(&task->thread, NULL, JobTaskWorker, task) == 0) return task;
+    pthread_mutex_destroy(&task->mutex);
+#endif
+
+    // Task run synchronously, no thread to join
+    func(data, 0);
+    task->func = NULL;
+    task->done = true;
+
+    return task;
+}
+
+// Check if background task is done, task data can be read once done
+// NOTE: A NULL task (run synchronously) is always done
+bool IsJobTaskDone(JobTask *task)
+{
+    if ((task == NULL) || (task->func == NULL)) return true;
+
+    bool done = false;
+
+#if !defined(PLATFORM_WEB)
+    LockJobMutex(&task->mutex);
+    done = task->done;
+    UnlockJobMutex(&task->mutex);
+#endif
+
+    return done;
+}
+
+// Wait for background task to finish and unload it
+void WaitJobTask(JobTask *task)
+{
+    if (task == NULL) return;
+
+#if !defined(PLATFORM_WEB)
+    if (task->func != NULL)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(task->thread, INFINITE);
+        CloseHandle(task->thread);
+        DeleteCriticalSection(&task->mutex);
+    #else
+        pthread_join(task->thread, NULL);
+        pthread_mutex_destroy(&task->mutex);
+    #endif
+    }
+#endif
+
+    free(task);
+}
+
+// Get number of logical CPU cores available
+int GetCpuCount(void)
+{
+    int count = 1;
+
+#if defined(_WIN32)
+    SYSTEM_INFO info = { 0 };
+    GetSystemInfo(&info);
+    count = (int)info.dwNumberOfProcessors;
+#elif !defined(PLATFORM_WEB)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return (count < 1)? 1 : count;
+}
+
+// Get monotonic wall clock time in seconds, for jobs timing
+// NOTE: clock() measures process CPU time, added for all threads, not valid to measure parallel jobs
+double GetJobPoolTime(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER counter = { 0 };
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double)counter.QuadPart/(double)frequency.QuadPart;
+#elif !defined(PLATFORM_WEB)
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#else
+    return emscripten_get_now()/1000.0;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(PLATFORM_WEB)
+static void LockJobMutex(JobMutex *mutex)
+{
+#if defined(_WIN32)
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static void UnlockJobMutex(JobMutex *mutex)
+{
+#if defined(_WIN32)
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static void WaitJobCondition(JobCondition *condition, JobMutex *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableCS(condition, mutex, INFINITE);
+#else
+    pthread_cond_wait(condition, mutex);
+#endif
+}
+
+static void BroadcastJobCondition(JobCondition *condition)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(condition);
+#else
+    pthread_cond_broadcast(condition);
+#endif
+}
+
+// Take and run current batch jobs until exhausted, mutex must be locked
+// NOTE: Mutex is released while running every job
+static void RunBatchJobs(JobPool *pool)
+{
+    while (pool->nextJob < pool->jobCount)
+    {
+        int index = pool->nextJob++;
+        JobFunc func = pool->func;
+        void *data = pool->data;
+
+        UnlockJobMutex(&pool->mutex);
+        func(data, index);
+        LockJobMutex(&pool->mutex);
+
+        pool->doneCount++;
+        if (pool->doneCount == pool->jobCount) BroadcastJobCondition(&pool->batchDone);
+    }
+}
+
+// Worker thread entry point
+static JOB_THREAD_RESULT JobWorker(void *arg)
+{
+    JobPool *pool = (JobPool *)arg;
+    unsigned int batchId = 0;
+
+    LockJobMutex(&pool->mutex);
+
+    while (true)
+    {
+        while (!pool->quit && (pool->batchId == batchId)) WaitJobCondition(&pool->batchStart, &pool->mutex);
+
+        if (pool->quit) break;
+
+        batchId = pool->batchId;
+        RunBatchJobs(pool);
+    }
+
+    UnlockJobMutex(&pool->mutex);
+
+    return 0;
+}
+
+// Background task thread entry point
+static JOB_THREAD_RESULT JobTaskWorker(void *arg)
+{
+    JobTask *task = (JobTask *)arg;
+
+    task->func(task->data, 0);
+
+    LockJobMutex(&task->mutex);
+    task->done = true;
+    UnlockJobMutex(&task->mutex);
+
+    return 0;
+}
+#endif
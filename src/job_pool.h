@@ -0,0 +1,64 @@
+/*******************************************************************************************
+*
+*   raylib maze game - job pool module
+*
+*   Fixed-size worker threads pool running parallel-for jobs: RunJobs() calls a job
+*   function for every job index, distributing indices between workers and the calling
+*   thread, and returns when all jobs are done
+*
+*   Background tasks run a single job on a dedicated thread, without blocking the calling
+*   thread: StartJobTask() returns immediately, IsJobTaskDone() polls task completion
+*
+*   Threads backend: Win32 threads on Windows, POSIX threads on other platforms,
+*   PLATFORM_WEB runs all jobs (and tasks) serially on the calling thread
+*
+*   NOTE: This module does not depend on raylib, so it can be included along with
+*   platform headers (windows.h defines symbols that collide with raylib.h)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef JOB_POOL_H
+#define JOB_POOL_H
+
+#include <stdbool.h>        // Required for: bool
+
+#define JOB_POOL_MAX_THREADS        64      // Maximum number of threads in a pool (calling thread included)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Job function, called once for every job index
+typedef void (*JobFunc)(void *data, int index);
+
+// Job pool, opaque type
+typedef struct JobPool JobPool;
+
+// Background job task, opaque type
+typedef struct JobTask JobTask;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+JobPool *LoadJobPool(int threadCount);                      // Load job pool, threads count includes calling thread (0 for all CPU cores)
+void UnloadJobPool(JobPool *pool);                          // Unload job pool, waiting for worker threads to finish
+void RunJobs(JobPool *pool, int jobCount, JobFunc func, void *data); // Run jobs [0..jobCount-1] in parallel, returns when all are done (pool can be NULL)
+int GetJobPoolThreadCount(JobPool *pool);                   // Get job pool threads count (calling thread included)
+
+JobTask *StartJobTask(JobFunc func, void *data);            // Start background task on a dedicated thread, job function called with index 0
+bool IsJobTaskDone(JobTask *task);                          // Check if background task is done, task data can be read once done
+void WaitJobTask(JobTask *task);                            // Wait for background task to finish and unload it
+
+int GetCpuCount(void);                                      // Get number of logical CPU cores available
+double GetJobPoolTime(void);                                // Get monotonic wall clock time in seconds, for jobs timing
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // JOB_POOL_H
@@ -0,0 +1,700 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze generation module
+*
+*   Procedural maze generator using Maze Grid Algorithm
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze.h"
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free(), abs()
+#include <string.h>     // Required for: memset(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// SIMD instruction set for cells/colors conversion kernels, scalar kernels used if not available
+// NOTE: Define MAZE_NO_SIMD to force scalar kernels
+#if !defined(MAZE_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define MAZE_SIMD_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define MAZE_SIMD_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze wall line reaching generation region bounds, extended by stitching pass
+typedef struct MazeWallLine {
+    Point position;             // Next line cell, first cell out of region
+    Point direction;            // Line direction
+} MazeWallLine;
+
+// Maze generation region (tile)
+typedef struct MazeGenTile {
+    int x;                      // Region first cell x
+    int y;                      // Region first cell y
+    int width;                  // Region width in cells
+    int height;                 // Region height in cells
+    MazeWallLine *lines;        // Lines reaching region bounds
+    int lineCount;              // Lines count
+    int lineCapacity;           // Lines array capacity
+} MazeGenTile;
+
+// Maze tiled generation jobs data
+typedef struct MazeGenJobs {
+    Maze *maze;
+    MazeGenTile *tiles;
+    int tilesX;
+    int spacingRows;
+    int spacingCols;
+    float pointChance;
+    unsigned int seed;
+} MazeGenJobs;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void GenMazeRegion(Maze *maze, MazeGenTile *region, int spacingRows, int spacingCols, float pointChance, MazeRandom *random); // Generate maze walls inside a region
+static void GenMazeTileJob(void *data, int index);          // Generate maze tile walls, job function
+static unsigned int GetMazeTileSeed(unsigned int seed, int tileX, int tileY); // Get maze tile seed, derived from maze seed and tile position
+static void DrawMazeBorder(Maze *maze);                      // Draw maze border walls
+static unsigned int GetColorValue(Color color);             // Get color as a 32bit value, same memory layout
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Set random generator seed
+// NOTE: Generator state is initialized from seed using splitmix64, as recommended by xoshiro authors
+void SetMazeRandomSeed(MazeRandom *random, unsigned int seed)
+{
+    unsigned long long state = seed;
+
+    for (int i = 0; i < 4; i++)
+    {
+        state += 0x9e3779b97f4a7c15ULL;
+
+        unsigned long long z = state;
+        z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+        z = z ^ (z >> 31);
+
+        random->state[i] = (unsigned int)(z >> 32);
+    }
+}
+
+// Get a random value between min and max (both included)
+int GetMazeRandomValue(MazeRandom *random, int min, int max)
+{
+    if (min > max)
+    {
+        int temp = max;
+        max = min;
+        min = temp;
+    }
+
+    // xoshiro128** generator step
+    unsigned int *s = random->state;
+    unsigned int value = s[1]*5;
+    value = ((value << 7) | (value >> 25))*9;
+
+    unsigned int t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+
+    return min + (int)(value%((unsigned int)(max - min) + 1));
+}
+
+// Generate empty maze, all cells walkable (max size: MAZE_MAX_SIZE)
+Maze GenMazeEmpty(int width, int height)
+{
+    Maze maze = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (width > MAZE_MAX_SIZE) || (height > MAZE_MAX_SIZE))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Invalid maze size (%ix%i), max size: %ix%i", width, height, MAZE_MAX_SIZE, MAZE_MAX_SIZE);
+        return maze;
+    }
+
+    int chunksX = (width + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE;
+    int chunksY = (height + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE;
+
+    maze.cells = (unsigned char *)calloc((size_t)chunksX*chunksY*MAZE_CHUNK_CELLS, sizeof(unsigned char));
+
+    if (maze.cells != NULL)
+    {
+        maze.width = width;
+        maze.height = height;
+        maze.chunksX = chunksX;
+        maze.chunksY = chunksY;
+
+        // Chunk cells out of maze bounds are set as walls, by chunk rows
+        int lastWidth = width - (chunksX - 1)*MAZE_CHUNK_SIZE;
+        int lastHeight = height - (chunksY - 1)*MAZE_CHUNK_SIZE;
+
+        for (int cy = 0; cy < chunksY; cy++)
+        {
+            unsigned char *lastChunk = GetMazeChunk(maze, chunksX - 1, cy);
+
+            if (lastWidth < MAZE_CHUNK_SIZE)
+            {
+                for (int y = 0; y < MAZE_CHUNK_SIZE; y++) memset(lastChunk + y*MAZE_CHUNK_SIZE + lastWidth, MAZE_CELL_WALL, MAZE_CHUNK_SIZE - lastWidth);
+            }
+        }
+
+        if (lastHeight < MAZE_CHUNK_SIZE)
+        {
+            for (int cx = 0; cx < chunksX; cx++)
+            {
+                unsigned char *chunk = GetMazeChunk(maze, cx, chunksY - 1);
+                memset(chunk + lastHeight*MAZE_CHUNK_SIZE, MAZE_CELL_WALL, (MAZE_CHUNK_SIZE - lastHeight)*MAZE_CHUNK_SIZE);
+            }
+        }
+    }
+
+    return maze;
+}
+
+// Generate procedural maze, using grid-based algorithm
+Maze GenMaze(int width, int height, int spacingRows, int spacingCols, float pointChance, MazeRandom *random)
+{
+    if (spacingRows < 1) spacingRows = 1;
+    if (spacingCols < 1) spacingCols = 1;
+
+    Maze maze = GenMazeEmpty(width, height);
+
+    if (maze.cells == NULL) return maze;
+
+    // STEP 1: Draw maze border
+    DrawMazeBorder(&maze);
+
+    // STEP 2: Generate maze walls, whole maze as a single region
+    // NOTE: Maze border is always a wall, so lines never get out of region
+    MazeGenTile region = { 0, 0, width, height, NULL, 0, 0 };
+    GenMazeRegion(&maze, &region, spacingRows, spacingCols, pointChance, random);
+    free(region.lines);
+
+    return maze;
+}
+
+// Generate procedural maze by tiles, tiles are generated in parallel using job pool (can be NULL)
+// NOTE: Every tile uses its own random generator, seeded from maze seed and tile position, and
+// wall lines reaching tile bounds are extended by a serial stitching pass, in tiles order, so
+// generated maze only depends on seed and parameters, never on threads count
+// NOTE: A maze fitting in a single tile is equal to GenMaze() with a generator seeded with seed
+Maze GenMazeTiled(int width, int height, int spacingRows, int spacingCols, float pointChance, unsigned int seed, JobPool *pool)
+{
+    if (spacingRows < 1) spacingRows = 1;
+    if (spacingCols < 1) spacingCols = 1;
+
+    Maze maze = GenMazeEmpty(width, height);
+
+    if (maze.cells == NULL) return maze;
+
+    // STEP 1: Draw maze border
+    DrawMazeBorder(&maze);
+
+    // STEP 2: Generate tiles walls in parallel
+    // NOTE: Tiles are aligned to chunks, every job only writes its own chunks memory
+    int tilesX = (width + MAZE_GEN_TILE_SIZE - 1)/MAZE_GEN_TILE_SIZE;
+    int tilesY = (height + MAZE_GEN_TILE_SIZE - 1)/MAZE_GEN_TILE_SIZE;
+    MazeGenTile *tiles = (MazeGenTile *)calloc(tilesX*tilesY, sizeof(MazeGenTile));
+
+    if (tiles == NULL)
+    {
+        UnloadMaze(maze);
+        return (Maze){ 0 };
+    }
+
+    for (int i = 0; i < tilesX*tilesY; i++)
+    {
+        tiles[i].x = (i%tilesX)*MAZE_GEN_TILE_SIZE;
+        tiles[i].y = (i/tilesX)*MAZE_GEN_TILE_SIZE;
+        tiles[i].width = ((tiles[i].x + MAZE_GEN_TILE_SIZE) > width)? (width - tiles[i].x) : MAZE_GEN_TILE_SIZE;
+        tiles[i].height = ((tiles[i].y + MAZE_GEN_TILE_SIZE) > height)? (height - tiles[i].y) : MAZE_GEN_TILE_SIZE;
+    }
+
+    MazeGenJobs jobs = { &maze, tiles, tilesX, spacingRows, spacingCols, pointChance, seed };
+    RunJobs(pool, tilesX*tilesY, GenMazeTileJob, &jobs);
+
+    // STEP 3: Stitch tiles seams, extending lines into neighbor tiles until they collide with a wall
+    for (int i = 0; i < tilesX*tilesY; i++)
+    {
+        for (int l = 0; l < tiles[i].lineCount; l++)
+        {
+            Point nextPoint = tiles[i].lines[l].position;
+            Point currentDir = tiles[i].lines[l].direction;
+
+            while (GetMazeCell(maze, nextPoint.x, nextPoint.y) == MAZE_CELL_FLOOR)
+            {
+                SetMazeCell(&maze, nextPoint.x, nextPoint.y, MAZE_CELL_WALL);
+                nextPoint.x += currentDir.x;
+                nextPoint.y += currentDir.y;
+            }
+        }
+
+        free(tiles[i].lines);
+    }
+
+    free(tiles);
+
+    return maze;
+}
+
+// Unload maze cells data from memory
+void UnloadMaze(Maze maze)
+{
+    free(maze.cells);
+}
+
+// Get maze cells hash (FNV-1a), to check mazes are equal
+// NOTE: Maze size is included, padding cells are always walls so whole chunks can be hashed
+unsigned int GetMazeHash(Maze maze)
+{
+    unsigned int hash = 2166136261u;
+
+    hash = (hash ^ (unsigned int)maze.width)*16777619u;
+    hash = (hash ^ (unsigned int)maze.height)*16777619u;
+
+    if (maze.cells == NULL) return hash;
+
+    size_t cellCount = (size_t)maze.chunksX*maze.chunksY*MAZE_CHUNK_CELLS;
+
+    for (size_t i = 0; i < cellCount; i++) hash = (hash ^ maze.cells[i])*16777619u;
+
+    return hash;
+}
+
+// Fill a rectangle of cells, clipped to maze bounds
+// NOTE: Cells are filled by chunk row spans, one memset() per span
+void FillMazeCells(Maze *maze, int posX, int posY, int width, int height, int cell)
+{
+    int startX = (posX < 0)? 0 : posX;
+    int startY = (posY < 0)? 0 : posY;
+    int endX = ((posX + width) > maze->width)? maze->width : (posX + width);
+    int endY = ((posY + height) > maze->height)? maze->height : (posY + height);
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; )
+        {
+            int spanEnd = ((x | MAZE_CHUNK_MASK) + 1 < endX)? ((x | MAZE_CHUNK_MASK) + 1) : endX;
+
+            memset(maze->cells + GetMazeCellIndex(*maze, x, y), cell, spanEnd - x);
+            x = spanEnd;
+        }
+    }
+}
+
+// Draw a 4-connected line of cells, out of bounds cells are ignored
+// NOTE: Consecutive cells always share an edge (no diagonal steps), so a walkable
+// line drawn over walls can always be walked with 4-directional movement
+// NOTE: Horizontal and vertical lines are filled as a cells rectangle
+void DrawMazeLine(Maze *maze, int startX, int startY, int endX, int endY, int cell)
+{
+    if ((startX == endX) || (startY == endY))
+    {
+        int posX = (startX < endX)? startX : endX;
+        int posY = (startY < endY)? startY : endY;
+
+        FillMazeCells(maze, posX, posY, abs(endX - startX) + 1, abs(endY - startY) + 1, cell);
+        return;
+    }
+
+    int dx = abs(endX - startX);
+    int dy = abs(endY - startY);
+    int stepX = (startX < endX)? 1 : -1;
+    int stepY = (startY < endY)? 1 : -1;
+    int error = 0;
+    int x = startX;
+    int y = startY;
+
+    SetMazeCell(maze, x, y, cell);
+
+    for (int i = 0; i < (dx + dy); i++)
+    {
+        // Step in the axis that keeps the line closer to the ideal segment
+        if (abs(error + dy) < abs(error - dx))
+        {
+            x += stepX;
+            error += dy;
+        }
+        else
+        {
+            y += stepY;
+            error -= dx;
+        }
+
+        SetMazeCell(maze, x, y, cell);
+    }
+}
+
+// Get display color for a maze cell type
+Color GetMazeCellColor(int cell)
+{
+    Color color = BLACK;
+
+    switch (cell)
+    {
+        case MAZE_CELL_WALL: color = WHITE; break;
+        case MAZE_CELL_ITEM: color = RED; break;
+        case MAZE_CELL_END: color = GREEN; break;
+        default: break;
+    }
+
+    return color;
+}
+
+// Get maze cell types from colors, colors not in maze color scheme are walkable cells
+// NOTE: Colors must be equal (all channels, as ColorIsEqual()), four colors compared per
+// instruction with SIMD kernels, 16 cells stored at once
+void GetMazeCellsFromColors(const Color *colors, unsigned char *cells, int count)
+{
+    unsigned int wallValue = GetColorValue(WHITE);
+    unsigned int itemValue = GetColorValue(RED);
+    unsigned int endValue = GetColorValue(GREEN);
+    int i = 0;
+
+#if defined(MAZE_SIMD_SSE2)
+    const __m128i wallColor = _mm_set1_epi32((int)wallValue);
+    const __m128i itemColor = _mm_set1_epi32((int)itemValue);
+    const __m128i endColor = _mm_set1_epi32((int)endValue);
+    const __m128i wallType = _mm_set1_epi32(MAZE_CELL_WALL);
+    const __m128i itemType = _mm_set1_epi32(MAZE_CELL_ITEM);
+    const __m128i endType = _mm_set1_epi32(MAZE_CELL_END);
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        __m128i types[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128i values = _mm_loadu_si128((const __m128i *)(colors + i + k*4));
+
+            types[k] = _mm_or_si128(_mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(values, wallColor), wallType),
+                _mm_and_si128(_mm_cmpeq_epi32(values, itemColor), itemType)),
+                _mm_and_si128(_mm_cmpeq_epi32(values, endColor), endType));
+        }
+
+        // Types are small values, packing with saturation does not modify them
+        _mm_storeu_si128((__m128i *)(cells + i), _mm_packus_epi16(_mm_packs_epi32(types[0], types[1]), _mm_packs_epi32(types[2], types[3])));
+    }
+#elif defined(MAZE_SIMD_NEON)
+    const uint32x4_t wallColor = vdupq_n_u32(wallValue);
+    const uint32x4_t itemColor = vdupq_n_u32(itemValue);
+    const uint32x4_t endColor = vdupq_n_u32(endValue);
+    const uint32x4_t wallType = vdupq_n_u32(MAZE_CELL_WALL);
+    const uint32x4_t itemType = vdupq_n_u32(MAZE_CELL_ITEM);
+    const uint32x4_t endType = vdupq_n_u32(MAZE_CELL_END);
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        uint16x4_t types[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            uint32x4_t values = vld1q_u32((const uint32_t *)(colors + i + k*4));
+
+            types[k] = vmovn_u32(vorrq_u32(vorrq_u32(
+                vandq_u32(vceqq_u32(values, wallColor), wallType),
+                vandq_u32(vceqq_u32(values, itemColor), itemType)),
+                vandq_u32(vceqq_u32(values, endColor), endType)));
+        }
+
+        vst1q_u8(cells + i, vcombine_u8(vmovn_u16(vcombine_u16(types[0], types[1])), vmovn_u16(vcombine_u16(types[2], types[3]))));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        unsigned int value = GetColorValue(colors[i]);
+
+        if (value == wallValue) cells[i] = MAZE_CELL_WALL;
+        else if (value == itemValue) cells[i] = MAZE_CELL_ITEM;
+        else if (value == endValue) cells[i] = MAZE_CELL_END;
+        else cells[i] = MAZE_CELL_FLOOR;
+    }
+}
+
+// Get display colors from maze cell types, same colors as GetMazeCellColor()
+// NOTE: All scheme colors are opaque and BLACK has no color channels set,
+// so every color can be selected with masks and combined with BLACK
+void GetMazeColorsFromCells(const unsigned char *cells, Color *colors, int count)
+{
+    int i = 0;
+
+#if defined(MAZE_SIMD_SSE2)
+    const __m128i floorColor = _mm_set1_epi32((int)GetColorValue(BLACK));
+    const __m128i wallColor = _mm_set1_epi32((int)GetColorValue(WHITE));
+    const __m128i itemColor = _mm_set1_epi32((int)GetColorValue(RED));
+    const __m128i endColor = _mm_set1_epi32((int)GetColorValue(GREEN));
+    const __m128i wallType = _mm_set1_epi32(MAZE_CELL_WALL);
+    const __m128i itemType = _mm_set1_epi32(MAZE_CELL_ITEM);
+    const __m128i endType = _mm_set1_epi32(MAZE_CELL_END);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(cells + i));
+        __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        __m128i types[4] = {
+            _mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero),
+            _mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero)
+        };
+
+        for (int k = 0; k < 4; k++)
+        {
+            __m128i values = _mm_or_si128(_mm_or_si128(floorColor,
+                _mm_and_si128(_mm_cmpeq_epi32(types[k], wallType), wallColor)), _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(types[k], itemType), itemColor),
+                _mm_and_si128(_mm_cmpeq_epi32(types[k], endType), endColor)));
+
+            _mm_storeu_si128((__m128i *)(colors + i + k*4), values);
+        }
+    }
+#elif defined(MAZE_SIMD_NEON)
+    const uint32x4_t floorColor = vdupq_n_u32(GetColorValue(BLACK));
+    const uint32x4_t wallColor = vdupq_n_u32(GetColorValue(WHITE));
+    const uint32x4_t itemColor = vdupq_n_u32(GetColorValue(RED));
+    const uint32x4_t endColor = vdupq_n_u32(GetColorValue(GREEN));
+    const uint32x4_t wallType = vdupq_n_u32(MAZE_CELL_WALL);
+    const uint32x4_t itemType = vdupq_n_u32(MAZE_CELL_ITEM);
+    const uint32x4_t endType = vdupq_n_u32(MAZE_CELL_END);
+
+    for (; (i + 16) <= count; i += 16)
+    {
+        uint8x16_t bytes = vld1q_u8(cells + i);
+        uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+        uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+        uint32x4_t types[4] = {
+            vmovl_u16(vget_low_u16(low)), vmovl_u16(vget_high_u16(low)),
+            vmovl_u16(vget_low_u16(high)), vmovl_u16(vget_high_u16(high))
+        };
+
+        for (int k = 0; k < 4; k++)
+        {
+            uint32x4_t values = vorrq_u32(vorrq_u32(floorColor,
+                vandq_u32(vceqq_u32(types[k], wallType), wallColor)), vorrq_u32(
+                vandq_u32(vceqq_u32(types[k], itemType), itemColor),
+                vandq_u32(vceqq_u32(types[k], endType), endColor)));
+
+            vst1q_u32((uint32_t *)(colors + i + k*4), values);
+        }
+    }
+#endif
+
+    for (; i < count; i++) colors[i] = GetMazeCellColor(cells[i]);
+}
+
+// Load RGBA image from maze cells, one pixel per cell
+// NOTE: Pixels are converted by chunk row spans, contiguous in cells data
+Image LoadImageFromMaze(Maze maze)
+{
+    Image image = { 0 };
+
+    if (maze.cells == NULL) return image;
+
+    Color *pixels = (Color *)RL_MALLOC(maze.width*maze.height*sizeof(Color));
+
+    for (int y = 0; y < maze.height; y++)
+    {
+        for (int x = 0; x < maze.width; x += MAZE_CHUNK_SIZE)
+        {
+            int span = ((x + MAZE_CHUNK_SIZE) > maze.width)? (maze.width - x) : MAZE_CHUNK_SIZE;
+
+            GetMazeColorsFromCells(maze.cells + GetMazeCellIndex(maze, x, y), pixels + y*maze.width + x, span);
+        }
+    }
+
+    image.data = pixels;
+    image.width = maze.width;
+    image.height = maze.height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    return image;
+}
+
+// Load maze from image, one cell per pixel, using maze color scheme
+// NOTE: Useful to import externally painted mazes, image is converted to RGBA if required
+Maze LoadMazeFromImage(Image image)
+{
+    Maze maze = { 0 };
+
+    if ((image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return maze;
+
+    Image rgba = image;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        rgba = ImageCopy(image);
+        ImageFormat(&rgba, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    maze = GenMazeEmpty(image.width, image.height);
+
+    if (maze.cells != NULL)
+    {
+        const Color *pixels = (const Color *)rgba.data;
+
+        for (int y = 0; y < maze.height; y++)
+        {
+            for (int x = 0; x < maze.width; x += MAZE_CHUNK_SIZE)
+            {
+                int span = ((x + MAZE_CHUNK_SIZE) > maze.width)? (maze.width - x) : MAZE_CHUNK_SIZE;
+
+                GetMazeCellsFromColors(pixels + y*maze.width + x, maze.cells + GetMazeCellIndex(maze, x, y), span);
+            }
+        }
+    }
+
+    if (rgba.data != image.data) UnloadImage(rgba);
+
+    return maze;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Generate maze walls inside a region, using grid-based algorithm
+// NOTE: Only region cells are read and written, lines reaching region bounds are stored in region
+static void GenMazeRegion(Maze *maze, MazeGenTile *region, int spacingRows, int spacingCols, float pointChance, MazeRandom *random)
+{
+    // Define an array of point used for maze generation
+    // NOTE: Dynamic array allocation, memory allocated in HEAP (MAX: Available RAM),
+    // sized for the maximum number of grid points the region can hold
+    int maxMazePoints = (region->width/spacingCols + 2)*(region->height/spacingRows + 2);
+    Point *mazePoints = (Point *)malloc(maxMazePoints*sizeof(Point));
+    int mazePointCounter = 0;
+
+    // Store specific points, at specific row-column distances
+    // NOTE: Points are placed on the maze grid, multiples of spacing, out of maze border
+    int startX = ((region->x + spacingCols - 1)/spacingCols)*spacingCols;
+    int startY = ((region->y + spacingRows - 1)/spacingRows)*spacingRows;
+    int endX = ((region->x + region->width) < (maze->width - 1))? (region->x + region->width) : (maze->width - 1);
+    int endY = ((region->y + region->height) < (maze->height - 1))? (region->y + region->height) : (maze->height - 1);
+    if (startX < spacingCols) startX = spacingCols;
+    if (startY < spacingRows) startY = spacingRows;
+
+    for (int y = startY; y < endY; y += spacingRows)
+    {
+        for (int x = startX; x < endX; x += spacingCols)
+        {
+            if (GetMazeRandomValue(random, 0, 100) <= (int)(pointChance*100.0f))
+            {
+                mazePoints[mazePointCounter] = (Point){ x, y };
+                mazePointCounter++;
+            }
+        }
+    }
+
+    // Draw our points in maze
+    for (int i = 0; i < mazePointCounter; i++) SetMazeCell(maze, mazePoints[i].x, mazePoints[i].y, MAZE_CELL_WALL);
+
+    // Draw lines from every point in a random direction
+
+    // Define an array of 4 directions for convenience
+    Point directions[4] = {
+        { 0, -1 }, // North
+        { 1, 0 },  // East
+        { 0, 1 },  // South
+        { -1, 0 }  // West
+    };
+
+    // Shuffle maze points (Fisher-Yates), so we process them randomly,
+    // instead of following the order we stored them
+    // NOTE: LoadRandomSequence() is not used, its cost is quadratic with the number of points
+    for (int i = mazePointCounter - 1; i > 0; i--)
+    {
+        int j = GetMazeRandomValue(random, 0, i);
+        Point temp = mazePoints[i];
+        mazePoints[i] = mazePoints[j];
+        mazePoints[j] = temp;
+    }
+
+    // Process every random maze point, drawing cells in one random direction,
+    // until we collision with another wall or get out of region
+    // NOTE: Cells out of region are never read, they can be generated by other threads
+    for (int i = 0; i < mazePointCounter; i++)
+    {
+        Point currentDir = directions[GetMazeRandomValue(random, 0, 3)];
+        Point nextPoint = { mazePoints[i].x + currentDir.x, mazePoints[i].y + currentDir.y };
+
+        while ((nextPoint.x >= region->x) && (nextPoint.x < (region->x + region->width)) &&
+               (nextPoint.y >= region->y) && (nextPoint.y < (region->y + region->height)) &&
+               (GetMazeCell(*maze, nextPoint.x, nextPoint.y) == MAZE_CELL_FLOOR))
+        {
+            SetMazeCell(maze, nextPoint.x, nextPoint.y, MAZE_CELL_WALL);
+            nextPoint.x += currentDir.x;
+            nextPoint.y += currentDir.y;
+        }
+
+        // Line reached region bounds, store it to be extended later
+        if ((nextPoint.x < region->x) || (nextPoint.x >= (region->x + region->width)) ||
+            (nextPoint.y < region->y) || (nextPoint.y >= (region->y + region->height)))
+        {
+            if (region->lineCount >= region->lineCapacity)
+            {
+                int capacity = (region->lineCapacity == 0)? 64 : region->lineCapacity*2;
+                MazeWallLine *lines = (MazeWallLine *)realloc(region->lines, capacity*sizeof(MazeWallLine));
+
+                if (lines == NULL) continue;
+
+                region->lines = lines;
+                region->lineCapacity = capacity;
+            }
+
+            region->lines[region->lineCount++] = (MazeWallLine){ nextPoint, currentDir };
+        }
+    }
+
+    free(mazePoints);
+}
+
+// Generate maze tile walls, job function
+static void GenMazeTileJob(void *data, int index)
+{
+    MazeGenJobs *jobs = (MazeGenJobs *)data;
+    MazeRandom random = { 0 };
+
+    SetMazeRandomSeed(&random, GetMazeTileSeed(jobs->seed, index%jobs->tilesX, index/jobs->tilesX));
+    GenMazeRegion(jobs->maze, &jobs->tiles[index], jobs->spacingRows, jobs->spacingCols, jobs->pointChance, &random);
+}
+
+// Get maze tile seed, derived from maze seed and tile position
+// NOTE: First tile uses maze seed, so single tile mazes are equal to GenMaze() mazes
+static unsigned int GetMazeTileSeed(unsigned int seed, int tileX, int tileY)
+{
+    return seed ^ ((unsigned int)tileX*0x9e3779b1u) ^ ((unsigned int)tileY*0x85ebca77u);
+}
+
+// Draw maze border walls
+// NOTE: Top and bottom rows are filled by chunk row spans
+static void DrawMazeBorder(Maze *maze)
+{
+    FillMazeCells(maze, 0, 0, maze->width, 1, MAZE_CELL_WALL);
+    FillMazeCells(maze, 0, maze->height - 1, maze->width, 1, MAZE_CELL_WALL);
+    FillMazeCells(maze, 0, 0, 1, maze->height, MAZE_CELL_WALL);
+    FillMazeCells(maze, maze->width - 1, 0, 1, maze->height, MAZE_CELL_WALL);
+}
+
+// Get color as a 32bit value, same memory layout
+static unsigned int GetColorValue(Color color)
+{
+    unsigned int value = 0;
+    memcpy(&value, &color, sizeof(unsigned int));
+
+    return value;
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze generation module
+*
+*   Procedural maze generator using Maze Grid Algorithm
+*
+*   Random numbers are generated with a MazeRandom generator (xoshiro128**) provided by
+*   the caller, generation does not depend on raylib global random state, so the same seed
+*   and parameters always generate the same maze, on any thread
+*
+*   Big mazes can be generated by tiles (MAZE_GEN_TILE_SIZE) in parallel on a job pool,
+*   every tile seeded from its position, with a stitching pass joining tiles seams
+*
+*   Maze data is stored as a dense grid of cells, one byte per cell, the RGBA image
+*   representation is only generated when required for display
+*
+*   Cells are stored in fixed-size square chunks (MAZE_CHUNK_SIZE x MAZE_CHUNK_SIZE),
+*   row-major inside every chunk and chunks row-major inside the maze, so any maze region
+*   can be processed chunk by chunk, only touching the memory required
+*
+*   NOTE: This module only uses raylib CPU-side image functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_H
+#define MAZE_H
+
+#include "raylib.h"
+
+#include "job_pool.h"           // Required for: JobPool
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_CHUNK_SHIFT        6                       // Maze chunk size, as power of two
+#define MAZE_CHUNK_SIZE         (1 << MAZE_CHUNK_SHIFT) // Maze chunk size in cells (64)
+#define MAZE_CHUNK_MASK         (MAZE_CHUNK_SIZE - 1)
+#define MAZE_CHUNK_CELLS        (MAZE_CHUNK_SIZE*MAZE_CHUNK_SIZE)
+
+#define MAZE_MAX_SIZE           16384                   // Maze maximum width/height in cells
+
+#define MAZE_GEN_TILE_SIZE      256                     // Maze tiled generation tile size in cells, multiple of chunk size
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Declare new data type: Point
+typedef struct Point {
+    int x;
+    int y;
+} Point;
+
+// Maze pseudo-random numbers generator state (xoshiro128**)
+typedef struct MazeRandom {
+    unsigned int state[4];      // Generator state, set with SetMazeRandomSeed()
+} MazeRandom;
+
+// Maze cell types
+// NOTE: Values are stored in a single byte per cell
+typedef enum {
+    MAZE_CELL_FLOOR = 0,        // Walkable cell (BLACK)
+    MAZE_CELL_WALL,             // Wall cell (WHITE)
+    MAZE_CELL_ITEM,             // Item cell (RED)
+    MAZE_CELL_END               // End-point cell (GREEN)
+} MazeCellType;
+
+// Maze grid, dense cells data stored by chunks
+// NOTE: Chunk cells out of maze bounds (last row/column of chunks) are walls
+typedef struct Maze {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    int chunksX;                // Maze chunks per row
+    int chunksY;                // Maze chunks per column
+    unsigned char *cells;       // Maze cells data (MazeCellType), MAZE_CHUNK_CELLS per chunk
+} Maze;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Maze random numbers generation
+void SetMazeRandomSeed(MazeRandom *random, unsigned int seed); // Set random generator seed
+int GetMazeRandomValue(MazeRandom *random, int min, int max); // Get a random value between min and max (both included)
+
+// Maze generation and unloading
+Maze GenMazeEmpty(int width, int height);                   // Generate empty maze, all cells walkable (max size: MAZE_MAX_SIZE)
+Maze GenMaze(int width, int height, int spacingRows, int spacingCols, float pointChance, MazeRandom *random); // Generate procedural maze, using grid-based algorithm
+Maze GenMazeTiled(int width, int height, int spacingRows, int spacingCols, float pointChance, unsigned int seed, JobPool *pool); // Generate procedural maze by tiles, in parallel (pool can be NULL)
+void UnloadMaze(Maze maze);                                 // Unload maze cells data from memory
+unsigned int GetMazeHash(Maze maze);                        // Get maze cells hash (FNV-1a), to check mazes are equal
+
+// Maze cells drawing
+void FillMazeCells(Maze *maze, int posX, int posY, int width, int height, int cell); // Fill a rectangle of cells, clipped to maze bounds
+void DrawMazeLine(Maze *maze, int startX, int startY, int endX, int endY, int cell); // Draw a 4-connected line of cells, out of bounds cells are ignored
+
+// Maze display conversion
+// NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable, RED = Item, GREEN = End-point
+// NOTE: Bulk conversions use SSE2/NEON kernels if available (scalar if MAZE_NO_SIMD defined)
+Color GetMazeCellColor(int cell);                           // Get display color for a maze cell type
+void GetMazeCellsFromColors(const Color *colors, unsigned char *cells, int count); // Get maze cell types from colors, colors not in maze color scheme are walkable cells
+void GetMazeColorsFromCells(const unsigned char *cells, Color *colors, int count); // Get display colors from maze cell types, same colors as GetMazeCellColor()
+Image LoadImageFromMaze(Maze maze);                         // Load RGBA image from maze cells, one pixel per cell
+Maze LoadMazeFromImage(Image image);                        // Load maze from image, one cell per pixel, using maze color scheme
+
+//----------------------------------------------------------------------------------
+// Maze cells access (inline)
+//----------------------------------------------------------------------------------
+// Get maze cell index in cells data, no bounds checking
+static inline int GetMazeCellIndex(Maze maze, int x, int y)
+{
+    return ((((y >> MAZE_CHUNK_SHIFT)*maze.chunksX + (x >> MAZE_CHUNK_SHIFT)) << (2*MAZE_CHUNK_SHIFT)) +
+        ((y & MAZE_CHUNK_MASK) << MAZE_CHUNK_SHIFT) + (x & MAZE_CHUNK_MASK));
+}
+
+// Get maze chunk cells data, no bounds checking
+static inline unsigned char *GetMazeChunk(Maze maze, int chunkX, int chunkY)
+{
+    return maze.cells + (chunkY*maze.chunksX + chunkX)*MAZE_CHUNK_CELLS;
+}
+
+// Get maze cell type, out of bounds cells are considered walls
+static inline int GetMazeCell(Maze maze, int x, int y)
+{
+    if ((x < 0) || (y < 0) || (x >= maze.width) || (y >= maze.height)) return MAZE_CELL_WALL;
+
+    return maze.cells[GetMazeCellIndex(maze, x, y)];
+}
+
+// Set maze cell type, out of bounds cells are ignored
+static inline void SetMazeCell(Maze *maze, int x, int y, int cell)
+{
+    if ((x < 0) || (y < 0) || (x >= maze->width) || (y >= maze->height)) return;
+
+    maze->cells[GetMazeCellIndex(*maze, x, y)] = (unsigned char)cell;
+}
+
+// Check if maze cell can be walked
+static inline bool IsMazeCellWalkable(Maze maze, int x, int y)
+{
+    return (GetMazeCell(maze, x, y) != MAZE_CELL_WALL);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_H
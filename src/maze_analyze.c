@@ -0,0 +1,415 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze quality analyzer tool
+*
+*   Sweeps seed ranges and generation parameters, analyzing every generated maze, so level
+*   designers can pick seeds by maze quality instead of trying them one by one; mazes are
+*   generated as the game does (GenMazeTiled()), same seed and parameters generate same maze
+*
+*   Maze analysis:
+*       - Connectivity: walkable cells connected components (union-find), largest component
+*       - Solvability: start cell (2, 2) and end cell (width - 2, height - 2) connected
+*       - Path length: shortest path steps from start to end (JPS), -1 if not solvable
+*       - Dead ends: walkable cells with only one walkable neighbor
+*       - Items: random items placed as maze_headless does (seeded by maze seed), items
+*         reachable from start cell
+*
+*   Mazes are analyzed in parallel on a job pool, by batches of consecutive mazes, results
+*   are written in seeds order (output does not depend on threads count) to an index file,
+*   one CSV line per maze, it can be sorted by any column with standard tools:
+*
+*       sort -t, -k6,6nr maze_index.csv     // Longest shortest paths first
+*
+*   Usage: maze_analyze [options]
+*       -n <count>          Number of seeds per parameters combination (default: 1000)
+*       -s <seed>           First seed of the range (default: 92683)
+*       -w <width>          Maze width in cells (default: 64)
+*       -h <height>         Maze height in cells (default: 64)
+*       -r <min[:max]>      Grid points spacing between rows range (default: 4)
+*       -c <min[:max]>      Grid points spacing between columns range (default: 4)
+*       -p <min[:max:step]> Grid points chance range [0.0f..1.0f] (default: 0.75)
+*       -i <items>          Random items per maze (default: 16)
+*       -t <threads>        Analysis threads, 0 for all CPU cores (default: 0)
+*       -o <file>           Output index file (default: maze_index.csv)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "maze.h"       // Required for: GenMazeTiled(), GetMazeRandomValue(), IsMazeCellWalkable()
+#include "maze_path.h"  // Required for: LoadMazePathFinder(), GetMazePathLength()
+#include "job_pool.h"   // Required for: LoadJobPool(), RunJobs(), GetJobPoolTime()
+
+#include <stdio.h>      // Required for: printf(), FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>     // Required for: atoi(), strtod(), strtoul(), malloc(), free()
+#include <string.h>     // Required for: strcmp()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define ANALYZE_JOB_MAZES       64          // Mazes analyzed per job, consecutive seeds
+#define ANALYZE_ROUND_JOBS      16          // Jobs per thread between index file writes
+#define MAX_ANALYZE_PARAMS      4096        // Maximum generation parameters combinations
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze generation parameters, one combination of the swept ranges
+typedef struct AnalyzeParams {
+    int spacingRows;            // Grid points spacing between rows
+    int spacingCols;            // Grid points spacing between columns
+    float pointChance;          // Grid points chance
+} AnalyzeParams;
+
+// Maze analysis result
+typedef struct MazeAnalysis {
+    unsigned int seed;          // Maze seed
+    int params;                 // Generation parameters index
+    bool solvable;              // End cell reachable from start cell
+    int pathLength;             // Shortest path steps from start to end, -1 if not solvable
+    int walkableCount;          // Walkable cells count
+    int componentCount;         // Walkable cells connected components
+    int largestComponent;       // Largest connected component cells count
+    int deadEndCount;           // Walkable cells with one walkable neighbor
+    int itemCount;              // Items placed
+    int reachableItems;         // Items reachable from start cell
+} MazeAnalysis;
+
+// Maze analysis jobs data, one round of consecutive mazes
+// NOTE: Maze index is params*seedCount + seed offset, so results are ordered by parameters and seed
+typedef struct AnalyzeJobs {
+    int width;                  // Mazes size
+    int height;
+    int itemCount;              // Random items per maze
+    unsigned int firstSeed;     // First seed of the range
+    int seedCount;              // Seeds per parameters combination
+    const AnalyzeParams *params; // Parameters combinations
+    long long firstMaze;        // Round first maze index
+    int mazeCount;              // Round mazes count
+    MazeAnalysis *results;      // Round results, mazeCount
+} AnalyzeJobs;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void AnalyzeMazesJob(void *data, int index);         // Analyze a batch of consecutive mazes, job function
+static MazeAnalysis AnalyzeMaze(Maze maze, int itemCount, unsigned int seed, int *parents, MazePathFinder *finder); // Analyze maze, parents is union-find memory (one value per cell)
+static int FindMazeComponent(int *parents, int index);      // Find cell component root, halving path
+static bool ParseRange(const char *text, double *min, double *max, double *step); // Parse range parameter: min[:max[:step]]
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int count = 1000;
+    unsigned int seed = 92683;
+    int width = 64;
+    int height = 64;
+    double rows[3] = { 4, 4, 1 };
+    double cols[3] = { 4, 4, 1 };
+    double chances[3] = { 0.75, 0.75, 0.05 };
+    int itemCount = 16;
+    int threadCount = 0;
+    const char *outputFile = "maze_index.csv";
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((argv[i][0] != '-') || (i == (argc - 1)))
+        {
+            printf("Usage: maze_analyze [-n count] [-s seed] [-w width] [-h height] [-r min[:max]] [-c min[:max]] [-p min[:max:step]] [-i items] [-t threads] [-o file]\n");
+            return 1;
+        }
+
+        bool valid = true;
+
+        if (strcmp(argv[i], "-n") == 0) count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-w") == 0) width = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-h") == 0) height = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-r") == 0) valid = ParseRange(argv[++i], &rows[0], &rows[1], NULL);
+        else if (strcmp(argv[i], "-c") == 0) valid = ParseRange(argv[++i], &cols[0], &cols[1], NULL);
+        else if (strcmp(argv[i], "-p") == 0) valid = ParseRange(argv[++i], &chances[0], &chances[1], &chances[2]);
+        else if (strcmp(argv[i], "-i") == 0) itemCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-t") == 0) threadCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-o") == 0) outputFile = argv[++i];
+        else
+        {
+            printf("Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+
+        if (!valid)
+        {
+            printf("Invalid range: %s %s\n", argv[i - 1], argv[i]);
+            return 1;
+        }
+    }
+
+    if ((count < 1) || (width < 8) || (height < 8) || (width > MAZE_MAX_SIZE) || (height > MAZE_MAX_SIZE) || (itemCount < 0) ||
+        (rows[0] < 1) || (cols[0] < 1) || (rows[1] < rows[0]) || (cols[1] < cols[0]) ||
+        (chances[0] < 0.0) || (chances[1] > 1.0) || (chances[1] < chances[0]) || (chances[2] <= 0.0))
+    {
+        printf("Invalid parameters: count >= 1, items >= 0, maze size in range [8..%i], spacing >= 1 and chance in range [0.0..1.0]\n", MAZE_MAX_SIZE);
+        return 1;
+    }
+
+    // Parameters combinations, point chance steps rounded to avoid floating point accumulation
+    AnalyzeParams *params = (AnalyzeParams *)malloc(MAX_ANALYZE_PARAMS*sizeof(AnalyzeParams));
+    int chanceSteps = (int)((chances[1] - chances[0])/chances[2] + 0.5) + 1;
+    int paramCount = 0;
+
+    for (int r = (int)rows[0]; r <= (int)rows[1]; r++)
+    {
+        for (int c = (int)cols[0]; c <= (int)cols[1]; c++)
+        {
+            for (int p = 0; (p < chanceSteps) && (paramCount < MAX_ANALYZE_PARAMS); p++)
+            {
+                params[paramCount++] = (AnalyzeParams){ r, c, (float)(chances[0] + p*chances[2]) };
+            }
+        }
+    }
+
+    if (paramCount == MAX_ANALYZE_PARAMS) printf("WARNING: Parameters combinations limited to %i\n", MAX_ANALYZE_PARAMS);
+
+    FILE *file = fopen(outputFile, "wt");
+
+    if (file == NULL)
+    {
+        printf("Failed to open index file: %s\n", outputFile);
+        free(params);
+        return 1;
+    }
+
+    fprintf(file, "seed,spacingRows,spacingCols,pointChance,solvable,pathLength,walkable,deadEnds,components,largestComponent,items,reachableItems\n");
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    JobPool *pool = LoadJobPool(threadCount);
+    int roundMazes = GetJobPoolThreadCount(pool)*ANALYZE_ROUND_JOBS*ANALYZE_JOB_MAZES;
+
+    AnalyzeJobs jobs = { 0 };
+    jobs.width = width;
+    jobs.height = height;
+    jobs.itemCount = itemCount;
+    jobs.firstSeed = seed;
+    jobs.seedCount = count;
+    jobs.params = params;
+    jobs.results = (MazeAnalysis *)malloc(roundMazes*sizeof(MazeAnalysis));
+
+    long long mazeCount = (long long)paramCount*count;
+    long long solvableCount = 0;
+    long long totalPathLength = 0;
+    long long totalDeadEnds = 0;
+    long long totalItems = 0;
+    long long totalReachableItems = 0;
+    double startTime = GetJobPoolTime();
+
+    // Mazes analyzed by rounds, round results written before next round
+    for (long long m = 0; m < mazeCount; m += roundMazes)
+    {
+        jobs.firstMaze = m;
+        jobs.mazeCount = ((mazeCount - m) < roundMazes)? (int)(mazeCount - m) : roundMazes;
+
+        RunJobs(pool, (jobs.mazeCount + ANALYZE_JOB_MAZES - 1)/ANALYZE_JOB_MAZES, AnalyzeMazesJob, &jobs);
+
+        for (int i = 0; i < jobs.mazeCount; i++)
+        {
+            MazeAnalysis result = jobs.results[i];
+            AnalyzeParams param = params[result.params];
+
+            fprintf(file, "%u,%i,%i,%.3f,%i,%i,%i,%i,%i,%i,%i,%i\n", result.seed, param.spacingRows, param.spacingCols, param.pointChance,
+                result.solvable, result.pathLength, result.walkableCount, result.deadEndCount, result.componentCount,
+                result.largestComponent, result.itemCount, result.reachableItems);
+
+            if (result.solvable)
+            {
+                solvableCount++;
+                totalPathLength += result.pathLength;
+            }
+
+            totalDeadEnds += result.deadEndCount;
+            totalItems += result.itemCount;
+            totalReachableItems += result.reachableItems;
+        }
+    }
+
+    double elapsedTime = GetJobPoolTime() - startTime;
+    bool written = (fclose(file) == 0);
+
+    UnloadJobPool(pool);
+    free(jobs.results);
+    free(params);
+
+    printf("Analyzed %lli mazes (%ix%i, %i parameters, %i seeds each) in %.3f seconds: %.0f mazes/s, %.1f M mazes/hour\n",
+        mazeCount, width, height, paramCount, count, elapsedTime, mazeCount/elapsedTime, mazeCount*3600.0/elapsedTime/1000000.0);
+    printf("Solvable: %lli (%.1f%%), %.1f average path length, %.1f average dead ends, %.1f%% items reachable\n",
+        solvableCount, solvableCount*100.0/mazeCount, (solvableCount > 0)? (double)totalPathLength/solvableCount : 0.0,
+        (double)totalDeadEnds/mazeCount, (totalItems > 0)? totalReachableItems*100.0/totalItems : 100.0);
+
+    if (!written) printf("Failed to write index file: %s\n", outputFile);
+
+    return written? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Analyze a batch of consecutive mazes, job function
+// NOTE: Mazes are generated serially on the job thread (no pool), tiled generation
+// does not depend on threads count, so mazes are the same generated by the game
+static void AnalyzeMazesJob(void *data, int index)
+{
+    AnalyzeJobs *jobs = (AnalyzeJobs *)data;
+    int first = index*ANALYZE_JOB_MAZES;
+    int last = ((first + ANALYZE_JOB_MAZES) < jobs->mazeCount)? (first + ANALYZE_JOB_MAZES) : jobs->mazeCount;
+
+    int *parents = (int *)malloc(jobs->width*jobs->height*sizeof(int));
+    MazePathFinder finder = { 0 };
+
+    for (int i = first; i < last; i++)
+    {
+        long long m = jobs->firstMaze + i;
+        AnalyzeParams param = jobs->params[m/jobs->seedCount];
+        unsigned int seed = jobs->firstSeed + (unsigned int)(m%jobs->seedCount);
+
+        Maze maze = GenMazeTiled(jobs->width, jobs->height, param.spacingRows, param.spacingCols, param.pointChance, seed, NULL);
+
+        // Path finder search memory reused by all job mazes, same size
+        if (finder.stamps == NULL) finder = LoadMazePathFinder(maze);
+
+        jobs->results[i] = AnalyzeMaze(maze, jobs->itemCount, seed, parents, &finder);
+        jobs->results[i].params = (int)(m/jobs->seedCount);
+
+        UnloadMaze(maze);
+    }
+
+    UnloadMazePathFinder(finder);
+    free(parents);
+}
+
+// Analyze maze, parents is union-find memory (one value per cell)
+// NOTE: Union-find uses negative parents for roots (component size) and union by size,
+// cells are joined with left and up walkable neighbors in a single pass
+static MazeAnalysis AnalyzeMaze(Maze maze, int itemCount, unsigned int seed, int *parents, MazePathFinder *finder)
+{
+    MazeAnalysis result = { 0 };
+    Point startCell = { 2, 2 };
+    Point endCell = { maze.width - 2, maze.height - 2 };
+
+    result.seed = seed;
+    result.pathLength = -1;
+
+    for (int y = 0; y < maze.height; y++)
+    {
+        for (int x = 0; x < maze.width; x++)
+        {
+            int index = y*maze.width + x;
+
+            // NOTE: Walls parent is never read, only walkable cells are searched
+            if (!IsMazeCellWalkable(maze, x, y))
+            {
+                parents[index] = 0;
+                continue;
+            }
+
+            bool left = IsMazeCellWalkable(maze, x - 1, y);
+            bool up = IsMazeCellWalkable(maze, x, y - 1);
+            int neighbors = left + up + IsMazeCellWalkable(maze, x + 1, y) + IsMazeCellWalkable(maze, x, y + 1);
+
+            result.walkableCount++;
+            if (neighbors == 1) result.deadEndCount++;
+
+            parents[index] = -1;
+
+            for (int n = 0; n < 2; n++)
+            {
+                if (!((n == 0)? left : up)) continue;
+
+                int root = FindMazeComponent(parents, (n == 0)? (index - 1) : (index - maze.width));
+                int cellRoot = FindMazeComponent(parents, index);
+
+                if (root == cellRoot) continue;
+
+                // Smaller component attached to bigger one
+                if (parents[root] > parents[cellRoot]) { int temp = root; root = cellRoot; cellRoot = temp; }
+
+                parents[root] += parents[cellRoot];
+                parents[cellRoot] = root;
+            }
+        }
+    }
+
+    for (int i = 0; i < maze.width*maze.height; i++)
+    {
+        if (parents[i] < 0)
+        {
+            result.componentCount++;
+            if (-parents[i] > result.largestComponent) result.largestComponent = -parents[i];
+        }
+    }
+
+    int startRoot = IsMazeCellWalkable(maze, startCell.x, startCell.y)? FindMazeComponent(parents, startCell.y*maze.width + startCell.x) : -1;
+
+    if ((startRoot >= 0) && IsMazeCellWalkable(maze, endCell.x, endCell.y) &&
+        (FindMazeComponent(parents, endCell.y*maze.width + endCell.x) == startRoot))
+    {
+        result.solvable = true;
+        result.pathLength = GetMazePathLength(finder, maze, startCell, endCell, MAZE_PATH_JPS);
+    }
+
+    // Random items on floor cells, same placement as maze_headless
+    MazeRandom random = { 0 };
+    SetMazeRandomSeed(&random, seed);
+
+    for (int i = 0; i < itemCount; i++)
+    {
+        Point cell = { GetMazeRandomValue(&random, 1, maze.width - 2), GetMazeRandomValue(&random, 1, maze.height - 2) };
+
+        if (GetMazeCell(maze, cell.x, cell.y) != MAZE_CELL_FLOOR) continue;
+
+        result.itemCount++;
+        if ((startRoot >= 0) && (FindMazeComponent(parents, cell.y*maze.width + cell.x) == startRoot)) result.reachableItems++;
+    }
+
+    return result;
+}
+
+// Find cell component root, halving path
+static int FindMazeComponent(int *parents, int index)
+{
+    while (parents[index] >= 0)
+    {
+        if (parents[parents[index]] >= 0) parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+
+    return index;
+}
+
+// Parse range parameter: min[:max[:step]]
+// NOTE: Missing max is min, missing step keeps provided default, step is only parsed if provided
+static bool ParseRange(const char *text, double *min, double *max, double *step)
+{
+    char *end = NULL;
+
+    *min = strtod(text, &end);
+    if (end == text) return false;
+
+    *max = *min;
+    if (*end == '\0') return true;
+    if (*end != ':') return false;
+
+    text = end + 1;
+    *max = strtod(text, &end);
+    if (end == text) return false;
+    if (*end == '\0') return true;
+    if ((*end != ':') || (step == NULL)) return false;
+
+    text = end + 1;
+    *step = strtod(text, &end);
+
+    return ((end != text) && (*end == '\0'));
+}
@@ -0,0 +1,1360 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze benchmark suite
+*
+*   Measures maze modules performance on increasing maze sizes, no window or audio device
+*   is initialized. Every benchmark takes several timed samples and reports percentile
+*   stats (min, mean, p50, p90, p99, max), printed to console as a table and optionally
+*   exported as JSON and CSV (stable output, fixed order and formatting) to track
+*   regressions across builds:
+*
+*     - Generation: maze generation time for several point chances (ms per maze), and
+*       streaming generation of the same size maze, row by row (ms per maze), stream windows
+*       are checked to be perfect mazes, generated and after scrolling
+*     - Queries: collision and item pickup query throughput (ns per query) and game
+*       simulation tick (ns per tick)
+*     - Pathfinding: distance field load and incremental update, path queries latency
+*       (BFS, A*, JPS) between random connected cells (ms per query), paths are validated
+*       against distance field distances, updated fields are checked against loaded fields
+*     - Tiles: tiles batch building for one view chunk, as done by draw loop (us per chunk),
+*       quads count, indices and texcoords are checked for every chunk and a clipped region
+*     - Model: 3d model mesh building for one chunk (us per chunk) and chunk triangles (tri),
+*       greedy merged faces compared to a naive mesh (one cube per wall, one quad per floor),
+*       greedy faces area is checked to be equal to visible cells faces count
+*     - File: level file export and loading (ms per maze), loaded maze, items, end-points,
+*       start cell and seed are checked to be equal to exported ones
+*     - Image: maze to RGBA image conversion and RGBA image classification into maze cells
+*       (ms per maze), classified mazes are checked to be equal to source maze
+*     - Swarm: bots swarm flow fields loading (ms per update) and bots update throughput
+*       (ns per bot), parallel updates are checked to be equal to serial updates
+*     - Journal: editor journal random strokes recording, undo all and redo all (ms per
+*       sample steps), undo, redo and snapshot restore are checked to give back maze and
+*       items hashes, replay onto a regenerated maze undone must give back regenerated maze
+*     - Generation scaling: tiled generation time of the biggest maze for 1 to N threads,
+*       generated mazes are checked to be equal for every threads count
+*
+*   Edge sizes (mazes sizes not multiple of chunk size) are validated once before benchmarks,
+*   partial edge chunks must generate only in-bounds tiles and level files must round-trip,
+*   truncated and corrupted level files must be rejected on loading
+*
+*   Validation errors are reported and the tool returns 1, benchmarks keep running
+*
+*   Usage: maze_bench [options]
+*       -s <seed>           Mazes generation seed (default: 92683)
+*       -n <samples>        Samples per benchmark, reduced for big mazes generation and fields (default: 31)
+*       -q <queries>        Path queries per maze size, one sample per query (default: 100)
+*       -m <maxSize>        Maximum maze size, mazes from 64x64 doubling size (default: 4096)
+*       -t <maxThreads>     Maximum threads for generation scaling (default: CPU cores count)
+*       -j <file>           Export results as JSON
+*       -c <file>           Export results as CSV
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "maze.h"       // Required for: GenMaze(), GetMazeRandomValue(), IsMazeCellWalkable()
+#include "maze_path.h"  // Required for: LoadMazeDistanceField(), LoadMazePathFinder(), GetMazePathLength()
+#include "maze_items.h" // Required for: LoadMazeItems(), AddMazeItem(), GetMazeItem()
+#include "maze_sim.h"   // Required for: InitMazeSim(), UpdateMazeSim()
+#include "maze_tiles.h" // Required for: GenMeshMazeTiles(), UnloadMeshData()
+#include "maze_model.h" // Required for: GenMeshMazeModel()
+#include "maze_swarm.h" // Required for: LoadMazeSwarm(), UpdateMazeSwarm(), GetMazeSwarmHash()
+#include "maze_stream.h" // Required for: LoadMazeStream(), GenMazeStreamRow(), GenMazeStreamWindow(), ScrollMazeStreamWindow()
+#include "maze_file.h"  // Required for: ExportMaze(), LoadMazeFile(), LoadMazeFromFile()
+#include "maze_journal.h" // Required for: LoadMazeJournal(), BeginMazeJournalEdit(), UndoMazeJournalStep(), ReplayMazeJournal()
+#include "job_pool.h"   // Required for: LoadJobPool(), GetCpuCount(), GetJobPoolTime()
+
+#include <stdio.h>      // Required for: printf(), FILE, fopen(), fprintf(), fclose(), remove()
+#include <stdlib.h>     // Required for: atoi(), strtoul(), malloc(), calloc(), free(), qsort(), abs()
+#include <string.h>     // Required for: strcmp(), memcmp(), memcpy(), snprintf()
+#include <math.h>       // Required for: fabs(), sqrtf()
+#include <stddef.h>     // Required for: offsetof()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_VERSION           1           // Results format version, changed if benchmarks change
+#define MAX_BENCH_RESULTS       256         // Maximum benchmarks results
+#define BENCH_QUERY_BATCH       65536       // Queries per sample for throughput benchmarks
+#define BENCH_SWARM_BOTS        65536       // Bots count for swarm benchmarks
+#define BENCH_FILE              "maze_bench.maze"   // Level file for file benchmarks, removed once done
+#define BENCH_JOURNAL_STEPS     64          // Editor steps per journal sample, random strokes and item toggles
+#define BENCH_STREAM_SCROLLS    5           // Stream window scrolls checked, one chunk row per scroll
+#define BENCH_FIELD_CHECK_STEP  4           // Field updates checked against a loaded field, one query every N queries
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark result, samples stats
+typedef struct BenchResult {
+    char name[48];              // Benchmark name: <benchmark>/<size>[/<parameter>]
+    const char *unit;           // Samples time unit: ms, us, ns
+    int sampleCount;            // Samples count
+    double min;                 // Minimum sample time
+    double mean;                // Mean sample time
+    double p50;                 // Percentile 50 (median)
+    double p90;                 // Percentile 90
+    double p99;                 // Percentile 99
+    double max;                 // Maximum sample time
+} BenchResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static BenchResult results[MAX_BENCH_RESULTS] = { 0 };
+static int resultCount = 0;
+static int errorCount = 0;                      // Validation errors count
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void AddBenchResult(const char *name, const char *unit, double *samples, int sampleCount); // Add benchmark result from samples (sorted in place)
+static int GetSizeSamples(int samples, int size);                    // Get samples for a maze size benchmark, reduced for big mazes
+static int CompareSamples(const void *a, const void *b);             // Compare samples for sorting
+static bool ExportBenchJson(const char *fileName, unsigned int seed, int samples, int queries); // Export results as JSON
+static bool ExportBenchCsv(const char *fileName);                    // Export results as CSV
+
+static void BenchMazeGen(int size, int samples, unsigned int seed);  // Benchmark maze generation, several point chances
+static bool CheckMazeStreamWindow(int width, unsigned int seed);     // Check stream window is a perfect maze, generated and after scrolling
+static bool CheckMazeStreamCells(Maze maze, bool topOpen);           // Check walkable cells form no cycles and every component reaches bottom row
+static void BenchMazeQueries(Maze maze, int samples, MazeRandom *random); // Benchmark collision, pickup and simulation tick throughput
+static void BenchMazePath(Maze maze, int samples, int queries, MazeRandom *random); // Benchmark maze pathfinding
+static bool CheckMazeDistanceField(MazeDistanceField field, Maze maze); // Check distance field is equal to a field loaded for the same maze and goal
+static void BenchMazeTiles(Maze maze, int samples);                  // Benchmark view chunks tiles batch building
+static bool CheckMazeTilesMesh(Maze maze, Rectangle cells, Mesh mesh, float scale); // Check tiles mesh quads, indices and texcoords for a maze cells region
+static void BenchMazeModel(Maze maze, int samples);                  // Benchmark 3d model chunks mesh building, greedy and naive
+static Mesh GenMeshMazeCubes(Maze maze, Rectangle cells, float wallHeight); // Generate naive 3d mesh for a maze cells region, one cube per wall
+static void BenchMazeFile(Maze maze, int samples, MazeRandom *random); // Benchmark level file export and loading
+static bool CheckMazeFileRoundTrip(Maze maze, const Point *items, int itemCount, Point start, unsigned int seed); // Check level file export and loading generate same maze, items, end-points, start and seed
+static bool CheckMazeFileCorruption(Maze maze);                       // Check truncated and corrupted level files are rejected
+static void BenchMazeImage(Maze maze, int samples);                  // Benchmark maze image conversion and classification
+static void BenchMazeSwarm(Maze maze, int samples, MazeRandom *random, JobPool *pool); // Benchmark bots swarm flow fields and update
+static void BenchMazeJournal(Maze maze, int samples, MazeRandom *random); // Benchmark editor journal edits recording, undo and redo
+static unsigned int GetBenchItemsHash(MazeItems items);              // Get items cells hash, independent of items order
+static void BenchMazeGenScaling(int size, unsigned int seed, int maxThreads); // Benchmark maze tiled generation scaling
+static void CheckMazeEdgeSizes(unsigned int seed);                    // Check mazes with partial edge chunks (sizes not multiple of chunk size)
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    unsigned int seed = 92683;
+    int samples = 31;
+    int queries = 100;
+    int maxSize = 4096;
+    int maxThreads = GetCpuCount();
+    const char *jsonFile = NULL;
+    const char *csvFile = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((argv[i][0] != '-') || (i == (argc - 1)))
+        {
+            printf("Usage: maze_bench [-s seed] [-n samples] [-q queries] [-m maxSize] [-t maxThreads] [-j jsonFile] [-c csvFile]\n");
+            return 1;
+        }
+
+        if (strcmp(argv[i], "-s") == 0) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-n") == 0) samples = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-q") == 0) queries = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-m") == 0) maxSize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-t") == 0) maxThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-j") == 0) jsonFile = argv[++i];
+        else if (strcmp(argv[i], "-c") == 0) csvFile = argv[++i];
+        else
+        {
+            printf("Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if ((samples < 1) || (queries < 1) || (maxSize < 64) || (maxSize > MAZE_MAX_SIZE) || (maxThreads < 1) || (maxThreads > JOB_POOL_MAX_THREADS))
+    {
+        printf("Invalid parameters: samples and queries must be >= 1, max size in range [64..%i] and max threads in range [1..%i]\n", MAZE_MAX_SIZE, JOB_POOL_MAX_THREADS);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    JobPool *pool = LoadJobPool(maxThreads);
+
+    CheckMazeEdgeSizes(seed);
+
+    printf("%-28s %-4s %7s %12s %12s %12s %12s %12s %12s\n", "benchmark", "unit", "samples", "min", "mean", "p50", "p90", "p99", "max");
+
+    for (int size = 64; size <= maxSize; size *= 2)
+    {
+        BenchMazeGen(size, samples, seed);
+
+        MazeRandom random = { 0 };
+        SetMazeRandomSeed(&random, seed);
+
+        Maze maze = GenMaze(size, size, 4, 4, 0.75f, &random);
+
+        if (maze.cells == NULL) break;
+
+        BenchMazeQueries(maze, samples, &random);
+        BenchMazePath(maze, samples, queries, &random);
+        BenchMazeTiles(maze, samples);
+        BenchMazeModel(maze, samples);
+        BenchMazeFile(maze, GetSizeSamples(samples, size), &random);
+        BenchMazeImage(maze, GetSizeSamples(samples, size));
+        BenchMazeSwarm(maze, GetSizeSamples(samples, size), &random, pool);
+        BenchMazeJournal(maze, GetSizeSamples(samples, size), &random);
+
+        UnloadMaze(maze);
+    }
+
+    UnloadJobPool(pool);
+
+    BenchMazeGenScaling(maxSize, seed, maxThreads);
+
+    if ((jsonFile != NULL) && !ExportBenchJson(jsonFile, seed, samples, queries)) printf("Failed to export JSON results: %s\n", jsonFile);
+    if ((csvFile != NULL) && !ExportBenchCsv(csvFile)) printf("Failed to export CSV results: %s\n", csvFile);
+
+    if (errorCount > 0) printf("WARNING: %i validation errors\n", errorCount);
+
+    return (errorCount == 0)? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Add benchmark result from samples (sorted in place)
+// NOTE: Percentiles use nearest-rank method, always an actual sample value
+static void AddBenchResult(const char *name, const char *unit, double *samples, int sampleCount)
+{
+    if ((resultCount >= MAX_BENCH_RESULTS) || (sampleCount < 1)) return;
+
+    qsort(samples, sampleCount, sizeof(double), CompareSamples);
+
+    BenchResult *result = &results[resultCount++];
+    double total = 0.0;
+
+    for (int i = 0; i < sampleCount; i++) total += samples[i];
+
+    snprintf(result->name, sizeof(result->name), "%s", name);
+    result->unit = unit;
+    result->sampleCount = sampleCount;
+    result->min = samples[0];
+    result->mean = total/sampleCount;
+    result->p50 = samples[(sampleCount*50 + 99)/100 - 1];
+    result->p90 = samples[(sampleCount*90 + 99)/100 - 1];
+    result->p99 = samples[(sampleCount*99 + 99)/100 - 1];
+    result->max = samples[sampleCount - 1];
+
+    printf("%-28s %-4s %7i %12.4f %12.4f %12.4f %12.4f %12.4f %12.4f\n", result->name, result->unit, result->sampleCount,
+        result->min, result->mean, result->p50, result->p90, result->p99, result->max);
+}
+
+// Get samples for a maze size benchmark, reduced for big mazes
+// NOTE: Samples are reduced proportionally to maze size from 64x64, keeping at least 3 samples
+static int GetSizeSamples(int samples, int size)
+{
+    int sizeSamples = (int)((long long)samples*64/size);
+    if (sizeSamples < 3) sizeSamples = (samples < 3)? samples : 3;
+
+    return sizeSamples;
+}
+
+// Compare samples for sorting
+static int CompareSamples(const void *a, const void *b)
+{
+    double sampleA = *(const double *)a;
+    double sampleB = *(const double *)b;
+
+    return (sampleA > sampleB) - (sampleA < sampleB);
+}
+
+// Export results as JSON
+// NOTE: Output only depends on results, no dates or machine data, so files can be compared
+static bool ExportBenchJson(const char *fileName, unsigned int seed, int samples, int queries)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"version\": %i,\n", BENCH_VERSION);
+    fprintf(file, "  \"seed\": %u,\n", seed);
+    fprintf(file, "  \"samples\": %i,\n", samples);
+    fprintf(file, "  \"queries\": %i,\n", queries);
+    fprintf(file, "  \"errors\": %i,\n", errorCount);
+    fprintf(file, "  \"results\": [\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        fprintf(file, "    { \"name\": \"%s\", \"unit\": \"%s\", \"samples\": %i, \"min\": %.6f, \"mean\": %.6f, \"p50\": %.6f, \"p90\": %.6f, \"p99\": %.6f, \"max\": %.6f }%s\n",
+            results[i].name, results[i].unit, results[i].sampleCount, results[i].min, results[i].mean,
+            results[i].p50, results[i].p90, results[i].p99, results[i].max, (i < (resultCount - 1))? "," : "");
+    }
+
+    fprintf(file, "  ]\n");
+    fprintf(file, "}\n");
+
+    return (fclose(file) == 0);
+}
+
+// Export results as CSV
+static bool ExportBenchCsv(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    fprintf(file, "name,unit,samples,min,mean,p50,p90,p99,max\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        fprintf(file, "%s,%s,%i,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n", results[i].name, results[i].unit, results[i].sampleCount,
+            results[i].min, results[i].mean, results[i].p50, results[i].p90, results[i].p99, results[i].max);
+    }
+
+    return (fclose(file) == 0);
+}
+
+// Benchmark maze generation, several point chances
+static void BenchMazeGen(int size, int samples, unsigned int seed)
+{
+    const float pointChances[4] = { 0.25f, 0.5f, 0.75f, 1.0f };
+    int sizeSamples = GetSizeSamples(samples, size);
+
+    double *times = (double *)malloc(sizeSamples*sizeof(double));
+
+    for (int c = 0; c < 4; c++)
+    {
+        for (int i = 0; i < sizeSamples; i++)
+        {
+            MazeRandom random = { 0 };
+            SetMazeRandomSeed(&random, seed + i);
+
+            double startTime = GetJobPoolTime();
+            Maze maze = GenMaze(size, size, 4, 4, pointChances[c], &random);
+            times[i] = (GetJobPoolTime() - startTime)*1000.0;
+
+            UnloadMaze(maze);
+        }
+
+        AddBenchResult(TextFormat("gen/%i/%.2f", size, pointChances[c]), "ms", times, sizeSamples);
+    }
+
+    // Streaming generation, rows generated into a single row buffer (constant memory)
+    unsigned char *row = (unsigned char *)malloc(size);
+
+    for (int i = 0; i < sizeSamples; i++)
+    {
+        double startTime = GetJobPoolTime();
+        MazeStream stream = LoadMazeStream(size, seed + i);
+
+        for (int y = 0; y < size; y++) GenMazeStreamRow(&stream, row);
+
+        UnloadMazeStream(&stream);
+        times[i] = (GetJobPoolTime() - startTime)*1000.0;
+    }
+
+    AddBenchResult(TextFormat("gen_stream/%i", size), "ms", times, sizeSamples);
+
+    if (!CheckMazeStreamWindow(size, seed))
+    {
+        printf("WARNING: Maze stream %i window is not a perfect maze\n", size);
+        errorCount++;
+    }
+
+    free(row);
+    free(times);
+}
+
+// Check stream window is a perfect maze, generated and after scrolling
+// NOTE: Scrolled window must also be equal to a window generated after skipping scrolled rows,
+// so rows moved up and rows generated at bottom stay connected across the seam
+static bool CheckMazeStreamWindow(int width, unsigned int seed)
+{
+    int height = 4*MAZE_CHUNK_SIZE;
+    MazeStream stream = LoadMazeStream(width, seed);
+    Maze window = GenMazeStreamWindow(&stream, height);
+    bool valid = (window.cells != NULL) && CheckMazeStreamCells(window, false);
+
+    for (int i = 0; valid && (i < BENCH_STREAM_SCROLLS); i++)
+    {
+        ScrollMazeStreamWindow(&stream, &window, 1);
+        valid = CheckMazeStreamCells(window, true);
+    }
+
+    if (valid)
+    {
+        MazeStream reference = LoadMazeStream(width, seed);
+        unsigned char *row = (unsigned char *)malloc(width);
+
+        for (int y = 0; y < BENCH_STREAM_SCROLLS*MAZE_CHUNK_SIZE; y++) GenMazeStreamRow(&reference, row);
+
+        Maze expected = GenMazeStreamWindow(&reference, height);
+        valid = (expected.cells != NULL) && (GetMazeHash(expected) == GetMazeHash(window));
+
+        UnloadMaze(expected);
+        UnloadMazeStream(&reference);
+        free(row);
+    }
+
+    UnloadMaze(window);
+    UnloadMazeStream(&stream);
+
+    return valid;
+}
+
+// Check walkable cells form no cycles and every component reaches bottom row
+// NOTE: Cells are joined with union-find, joining two cells already connected is a cycle,
+// if topOpen, components touching top row can reach bottom row through evicted rows
+static bool CheckMazeStreamCells(Maze maze, bool topOpen)
+{
+    int count = maze.width*maze.height;
+    int *parents = (int *)malloc(count*sizeof(int));
+    unsigned char *reach = (unsigned char *)calloc(count, 1);   // Component flags: 1-bottom row, 2-top row
+    bool valid = (parents != NULL) && (reach != NULL);
+
+    for (int i = 0; valid && (i < count); i++) parents[i] = i;
+
+    for (int y = 0; valid && (y < maze.height); y++)
+    {
+        for (int x = 0; valid && (x < maze.width); x++)
+        {
+            if (!IsMazeCellWalkable(maze, x, y)) continue;
+
+            // Join cell with left and up neighbours, every passage is visited once
+            for (int n = 0; valid && (n < 2); n++)
+            {
+                int nx = (n == 0)? x - 1 : x;
+                int ny = (n == 0)? y : y - 1;
+
+                if (!IsMazeCellWalkable(maze, nx, ny)) continue;
+
+                int a = y*maze.width + x;
+                int b = ny*maze.width + nx;
+
+                while (parents[a] != a) a = parents[a] = parents[parents[a]];
+                while (parents[b] != b) b = parents[b] = parents[parents[b]];
+
+                if (a == b) valid = false;
+                else parents[a] = b;
+            }
+        }
+    }
+
+    for (int pass = 0; valid && (pass < 2); pass++)
+    {
+        for (int i = 0; valid && (i < count); i++)
+        {
+            if (!IsMazeCellWalkable(maze, i%maze.width, i/maze.width)) continue;
+
+            int root = i;
+            while (parents[root] != root) root = parents[root] = parents[parents[root]];
+
+            // First pass collects components flags, second pass checks every cell component
+            if (pass == 0) reach[root] |= ((i/maze.width) == (maze.height - 1))? 1 : (((i/maze.width) == 0)? 2 : 0);
+            else valid = ((reach[root] & 1) != 0) || (topOpen && ((reach[root] & 2) != 0));
+        }
+    }
+
+    free(parents);
+    free(reach);
+
+    return valid;
+}
+
+// Benchmark collision, pickup and simulation tick throughput
+// NOTE: Query cells are generated before timing, items are placed on 1/16 of random cells,
+// so about half pickup queries find an item
+static void BenchMazeQueries(Maze maze, int samples, MazeRandom *random)
+{
+    Point *cells = (Point *)malloc(BENCH_QUERY_BATCH*sizeof(Point));
+    unsigned int *inputs = (unsigned int *)malloc(BENCH_QUERY_BATCH*sizeof(unsigned int));
+    double *times = (double *)malloc(samples*sizeof(double));
+    volatile int sink = 0;
+
+    for (int i = 0; i < BENCH_QUERY_BATCH; i++)
+    {
+        cells[i] = (Point){ GetMazeRandomValue(random, 0, maze.width - 1), GetMazeRandomValue(random, 0, maze.height - 1) };
+        inputs[i] = 1 << GetMazeRandomValue(random, 0, 3);
+    }
+
+    // Collision queries, walkable cells check
+    for (int s = 0; s < samples; s++)
+    {
+        int walkableCount = 0;
+        double startTime = GetJobPoolTime();
+
+        for (int i = 0; i < BENCH_QUERY_BATCH; i++) walkableCount += IsMazeCellWalkable(maze, cells[i].x, cells[i].y);
+
+        times[s] = (GetJobPoolTime() - startTime)*1000000000.0/BENCH_QUERY_BATCH;
+        sink += walkableCount;
+    }
+
+    AddBenchResult(TextFormat("collision/%i", maze.width), "ns", times, samples);
+
+    // Pickup queries, items store lookup
+    int itemCount = maze.width*maze.height/16;
+    MazeItems items = LoadMazeItems(itemCount);
+
+    for (int i = 0; i < itemCount; i++) AddMazeItem(&items, (Point){ GetMazeRandomValue(random, 0, maze.width - 1), GetMazeRandomValue(random, 0, maze.height - 1) });
+    for (int i = 0; i < BENCH_QUERY_BATCH; i += 2) cells[i] = items.cells[GetMazeRandomValue(random, 0, items.count - 1)];
+
+    for (int s = 0; s < samples; s++)
+    {
+        int foundCount = 0;
+        double startTime = GetJobPoolTime();
+
+        for (int i = 0; i < BENCH_QUERY_BATCH; i++) foundCount += (GetMazeItem(items, cells[i]) >= 0);
+
+        times[s] = (GetJobPoolTime() - startTime)*1000000000.0/BENCH_QUERY_BATCH;
+        sink += foundCount;
+    }
+
+    AddBenchResult(TextFormat("pickup/%i/%i", maze.width, items.count), "ns", times, samples);
+
+    // Simulation ticks, random walk with items pickup, restarted when finished
+    for (int s = 0; s < samples; s++)
+    {
+        MazeSim sim = InitMazeSim((Point){ 2, 2 }, (Point){ maze.width - 2, maze.height - 2 });
+        ResetMazeItems(&items);
+
+        double startTime = GetJobPoolTime();
+
+        for (int i = 0; i < BENCH_QUERY_BATCH; i++)
+        {
+            UpdateMazeSim(&sim, maze, &items, inputs[(i >> 3) & (BENCH_QUERY_BATCH - 1)]);
+            if (sim.finished) sim = InitMazeSim(sim.startCell, sim.endCell);
+        }
+
+        times[s] = (GetJobPoolTime() - startTime)*1000000000.0/BENCH_QUERY_BATCH;
+        sink += sim.score;
+    }
+
+    AddBenchResult(TextFormat("sim/%i", maze.width), "ns", times, samples);
+
+    UnloadMazeItems(items);
+    free(cells);
+    free(inputs);
+    free(times);
+}
+
+// Benchmark maze pathfinding
+// NOTE: Query pairs are random cells connected to the goal cell, so all queries find a path
+static void BenchMazePath(Maze maze, int samples, int queries, MazeRandom *random)
+{
+    Point goal = { maze.width - 2, maze.height - 2 };
+    while (!IsMazeCellWalkable(maze, goal.x, goal.y)) goal = (Point){ GetMazeRandomValue(random, 1, maze.width - 2), GetMazeRandomValue(random, 1, maze.height - 2) };
+
+    int fieldSamples = GetSizeSamples(samples, maze.width);
+    double *times = (double *)malloc(((2*queries > fieldSamples)? 2*queries : fieldSamples)*sizeof(double));
+    MazeDistanceField field = { 0 };
+
+    for (int i = 0; i < fieldSamples; i++)
+    {
+        UnloadMazeDistanceField(field);
+
+        double startTime = GetJobPoolTime();
+        field = LoadMazeDistanceField(maze, goal);
+        times[i] = (GetJobPoolTime() - startTime)*1000.0;
+    }
+
+    AddBenchResult(TextFormat("field/%i", maze.width), "ms", times, fieldSamples);
+
+    // Select query start cells, connected to goal
+    Point *starts = (Point *)malloc(queries*sizeof(Point));
+
+    for (int i = 0; i < queries; i++)
+    {
+        do starts[i] = (Point){ GetMazeRandomValue(random, 1, maze.width - 2), GetMazeRandomValue(random, 1, maze.height - 2) };
+        while (GetMazeDistance(field, starts[i].x, starts[i].y) < 0);
+    }
+
+    // Path queries, lengths validated against distance field
+    const char *methodNames[3] = { "bfs", "astar", "jps" };
+    MazePathFinder finder = LoadMazePathFinder(maze);
+    int pathErrors = 0;
+
+    for (int method = MAZE_PATH_BFS; method <= MAZE_PATH_JPS; method++)
+    {
+        for (int i = 0; i < queries; i++)
+        {
+            double startTime = GetJobPoolTime();
+            int length = GetMazePathLength(&finder, maze, starts[i], goal, method);
+            times[i] = (GetJobPoolTime() - startTime)*1000.0;
+
+            if (length != GetMazeDistance(field, starts[i].x, starts[i].y)) pathErrors++;
+        }
+
+        AddBenchResult(TextFormat("path_%s/%i", methodNames[method], maze.width), "ms", times, queries);
+    }
+
+    // Incremental field updates, toggling random interior cells (restored after every update)
+    // NOTE: Updated fields are checked outside timing, only for a subset of queries (field loading is slow for big mazes)
+    int fieldErrors = 0;
+
+    for (int i = 0; i < queries; i++)
+    {
+        Point cell = { GetMazeRandomValue(random, 1, maze.width - 2), GetMazeRandomValue(random, 1, maze.height - 2) };
+        int prevCell = GetMazeCell(maze, cell.x, cell.y);
+        Rectangle cellRec = { (float)cell.x, (float)cell.y, 1, 1 };
+
+        SetMazeCell(&maze, cell.x, cell.y, (prevCell == MAZE_CELL_WALL)? MAZE_CELL_FLOOR : MAZE_CELL_WALL);
+        double startTime = GetJobPoolTime();
+        UpdateMazeDistanceField(&field, maze, cellRec);
+        times[i*2] = (GetJobPoolTime() - startTime)*1000.0;
+
+        if (((i % BENCH_FIELD_CHECK_STEP) == 0) && !CheckMazeDistanceField(field, maze)) fieldErrors++;
+
+        SetMazeCell(&maze, cell.x, cell.y, prevCell);
+        startTime = GetJobPoolTime();
+        UpdateMazeDistanceField(&field, maze, cellRec);
+        times[i*2 + 1] = (GetJobPoolTime() - startTime)*1000.0;
+
+        if (((i % BENCH_FIELD_CHECK_STEP) == 0) && !CheckMazeDistanceField(field, maze)) fieldErrors++;
+    }
+
+    AddBenchResult(TextFormat("field_update/%i", maze.width), "ms", times, 2*queries);
+
+    if (pathErrors > 0) printf("WARNING: %i path queries returned a wrong length\n", pathErrors);
+    errorCount += pathErrors;
+
+    if (fieldErrors > 0) printf("WARNING: %i distance field updates differ from loaded field\n", fieldErrors);
+    errorCount += fieldErrors;
+
+    UnloadMazePathFinder(finder);
+    UnloadMazeDistanceField(field);
+    free(starts);
+    free(times);
+}
+
+// Check distance field is equal to a field loaded for the same maze and goal
+// NOTE: Every cell distance is compared, including walls and unreachable cells
+static bool CheckMazeDistanceField(MazeDistanceField field, Maze maze)
+{
+    MazeDistanceField loaded = LoadMazeDistanceField(maze, field.goal);
+    bool equal = (loaded.distances != NULL);
+
+    for (int y = 0; equal && (y < maze.height); y++)
+    {
+        for (int x = 0; x < maze.width; x++)
+        {
+            if (GetMazeDistance(field, x, y) != GetMazeDistance(loaded, x, y))
+            {
+                equal = false;
+                break;
+            }
+        }
+    }
+
+    UnloadMazeDistanceField(loaded);
+
+    return equal;
+}
+
+// Benchmark view chunks tiles batch building
+// NOTE: One full chunk tiles mesh per sample, cycling over maze chunks, first mesh of every chunk
+// is checked, a region crossing maze bottom-right corner is checked to be clipped
+static void BenchMazeTiles(Maze maze, int samples)
+{
+    double *times = (double *)malloc(samples*sizeof(double));
+    int chunkCount = maze.chunksX*maze.chunksY;
+
+    for (int s = 0; s < samples; s++)
+    {
+        int chunk = s%chunkCount;
+        Rectangle cells = { (float)((chunk%maze.chunksX)*MAZE_CHUNK_SIZE), (float)((chunk/maze.chunksX)*MAZE_CHUNK_SIZE), MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE };
+
+        double startTime = GetJobPoolTime();
+        Mesh tiles = GenMeshMazeTiles(maze, cells, (Vector2){ 0.0f, 0.0f }, 10.0f);
+        times[s] = (GetJobPoolTime() - startTime)*1000000.0;
+
+        if ((s < chunkCount) && !CheckMazeTilesMesh(maze, cells, tiles, 10.0f))
+        {
+            printf("WARNING: Maze %ix%i chunk %i tiles mesh not valid\n", maze.width, maze.height, chunk);
+            errorCount++;
+        }
+
+        UnloadMeshData(tiles);
+    }
+
+    Rectangle corner = { (float)(maze.width - MAZE_CHUNK_SIZE/2), (float)(maze.height - MAZE_CHUNK_SIZE/2), MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE };
+    Mesh tiles = GenMeshMazeTiles(maze, corner, (Vector2){ 0.0f, 0.0f }, 10.0f);
+
+    if (!CheckMazeTilesMesh(maze, corner, tiles, 10.0f))
+    {
+        printf("WARNING: Maze %ix%i clipped tiles mesh not valid\n", maze.width, maze.height);
+        errorCount++;
+    }
+
+    UnloadMeshData(tiles);
+
+    AddBenchResult(TextFormat("tiles/%i", maze.width), "us", times, samples);
+
+    free(times);
+}
+
+// Check tiles mesh quads, indices and texcoords for a maze cells region
+// NOTE: Region is clipped to maze bounds, one quad per in-bounds cell expected in rows order,
+// quads are checked to be placed on their cell and to use the cell type atlas rectangle
+static bool CheckMazeTilesMesh(Maze maze, Rectangle cells, Mesh mesh, float scale)
+{
+    int startX = (cells.x < 0)? 0 : (int)cells.x;
+    int startY = (cells.y < 0)? 0 : (int)cells.y;
+    int endX = ((int)(cells.x + cells.width) > maze.width)? maze.width : (int)(cells.x + cells.width);
+    int endY = ((int)(cells.y + cells.height) > maze.height)? maze.height : (int)(cells.y + cells.height);
+    int width = (endX > startX)? (endX - startX) : 0;
+    int quadCount = ((endY > startY)? (endY - startY) : 0)*width;
+
+    if ((mesh.vertexCount != quadCount*4) || (mesh.triangleCount != quadCount*2)) return false;
+    if (quadCount == 0) return true;
+
+    for (int i = 0; i < mesh.triangleCount*3; i++)
+    {
+        if (mesh.indices[i] >= mesh.vertexCount) return false;
+    }
+
+    for (int q = 0; q < quadCount; q++)
+    {
+        int x = startX + q%width;
+        int y = startY + q/width;
+        Rectangle uv = GetMazeTileAtlasRec(GetMazeCell(maze, x, y));
+        const float *vertices = mesh.vertices + q*12;
+        const float *texcoords = mesh.texcoords + q*8;
+
+        // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+        if ((fabs(vertices[0] - x*scale) > 0.001) || (fabs(vertices[1] - y*scale) > 0.001) ||
+            (fabs(vertices[6] - (x + 1)*scale) > 0.001) || (fabs(vertices[7] - (y + 1)*scale) > 0.001)) return false;
+
+        if ((texcoords[0] != uv.x) || (texcoords[1] != uv.y) ||
+            (texcoords[2] != uv.x) || (texcoords[3] != (uv.y + uv.height)) ||
+            (texcoords[4] != (uv.x + uv.width)) || (texcoords[5] != (uv.y + uv.height)) ||
+            (texcoords[6] != (uv.x + uv.width)) || (texcoords[7] != uv.y)) return false;
+    }
+
+    return true;
+}
+
+// Benchmark 3d model chunks mesh building, greedy and naive
+// NOTE: One full chunk mesh per sample, cycling over maze chunks, triangles are reported per chunk,
+// greedy faces area must be equal to visible faces count (one per cell, plus walls sides facing walkable cells)
+static void BenchMazeModel(Maze maze, int samples)
+{
+    double *times = (double *)malloc(samples*sizeof(double));
+    double *naiveTimes = (double *)malloc(samples*sizeof(double));
+    double *triangles = (double *)malloc(samples*sizeof(double));
+    double *naiveTriangles = (double *)malloc(samples*sizeof(double));
+    int chunkCount = maze.chunksX*maze.chunksY;
+
+    for (int s = 0; s < samples; s++)
+    {
+        int chunk = s%chunkCount;
+        Rectangle cells = { (float)((chunk%maze.chunksX)*MAZE_CHUNK_SIZE), (float)((chunk/maze.chunksX)*MAZE_CHUNK_SIZE), MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE };
+
+        double startTime = GetJobPoolTime();
+        Mesh model = GenMeshMazeModel(maze, cells, 1.0f);
+        times[s] = (GetJobPoolTime() - startTime)*1000000.0;
+
+        startTime = GetJobPoolTime();
+        Mesh cubes = GenMeshMazeCubes(maze, cells, 1.0f);
+        naiveTimes[s] = (GetJobPoolTime() - startTime)*1000000.0;
+
+        triangles[s] = model.triangleCount;
+        naiveTriangles[s] = cubes.triangleCount;
+
+        if (s < chunkCount)
+        {
+            // Merged quads area, from quad corner (first vertex) edges
+            double area = 0.0;
+            int faces = 0;
+
+            for (int i = 0; i < model.vertexCount; i += 4)
+            {
+                const float *v = model.vertices + i*3;
+                float down = sqrtf((v[3] - v[0])*(v[3] - v[0]) + (v[4] - v[1])*(v[4] - v[1]) + (v[5] - v[2])*(v[5] - v[2]));
+                float right = sqrtf((v[9] - v[0])*(v[9] - v[0]) + (v[10] - v[1])*(v[10] - v[1]) + (v[11] - v[2])*(v[11] - v[2]));
+
+                area += down*right;
+            }
+
+            for (int y = (int)cells.y; (y < (int)(cells.y + cells.height)) && (y < maze.height); y++)
+            {
+                for (int x = (int)cells.x; (x < (int)(cells.x + cells.width)) && (x < maze.width); x++)
+                {
+                    faces++;
+
+                    if (!IsMazeCellWalkable(maze, x, y))
+                    {
+                        faces += IsMazeCellWalkable(maze, x + 1, y) + IsMazeCellWalkable(maze, x - 1, y) +
+                            IsMazeCellWalkable(maze, x, y + 1) + IsMazeCellWalkable(maze, x, y - 1);
+                    }
+                }
+            }
+
+            if (fabs(area - faces) > 0.001)
+            {
+                printf("WARNING: Maze %ix%i chunk %i model faces area %.3f, expected %i\n", maze.width, maze.height, chunk, area, faces);
+                errorCount++;
+            }
+        }
+
+        UnloadMeshData(model);
+        UnloadMeshData(cubes);
+    }
+
+    AddBenchResult(TextFormat("model/%i", maze.width), "us", times, samples);
+    AddBenchResult(TextFormat("model_naive/%i", maze.width), "us", naiveTimes, samples);
+    AddBenchResult(TextFormat("model_tris/%i", maze.width), "tri", triangles, samples);
+    AddBenchResult(TextFormat("model_naive_tris/%i", maze.width), "tri", naiveTriangles, samples);
+
+    free(times);
+    free(naiveTimes);
+    free(triangles);
+    free(naiveTriangles);
+}
+
+// Generate naive 3d mesh for a maze cells region, one cube per wall
+// NOTE: Walkable cells get one floor quad, not indexed (a full walls chunk exceeds 16bit indices)
+static Mesh GenMeshMazeCubes(Maze maze, Rectangle cells, float wallHeight)
+{
+    Mesh mesh = { 0 };
+
+    int startX = (int)cells.x;
+    int startY = (int)cells.y;
+    int endX = ((int)(cells.x + cells.width) > maze.width)? maze.width : (int)(cells.x + cells.width);
+    int endY = ((int)(cells.y + cells.height) > maze.height)? maze.height : (int)(cells.y + cells.height);
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++) mesh.triangleCount += IsMazeCellWalkable(maze, x, y)? 2 : 12;
+    }
+
+    mesh.vertexCount = mesh.triangleCount*3;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+
+    // Cube faces corners (unit cube), two triangles per face: top, bottom, east, west, south, north
+    static const float cubeFaces[6][4][3] = {
+        { { 0, 1, 0 }, { 0, 1, 1 }, { 1, 1, 1 }, { 1, 1, 0 } },
+        { { 0, 0, 1 }, { 0, 0, 0 }, { 1, 0, 0 }, { 1, 0, 1 } },
+        { { 1, 1, 1 }, { 1, 0, 1 }, { 1, 0, 0 }, { 1, 1, 0 } },
+        { { 0, 1, 0 }, { 0, 0, 0 }, { 0, 0, 1 }, { 0, 1, 1 } },
+        { { 0, 1, 1 }, { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 } },
+        { { 1, 1, 0 }, { 1, 0, 0 }, { 0, 0, 0 }, { 0, 1, 0 } }
+    };
+    static const int quadCorners[6] = { 0, 1, 2, 0, 2, 3 };
+    static const float quadTexcoords[4][2] = { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 1, 0 } };
+
+    float *vertices = mesh.vertices;
+    float *texcoords = mesh.texcoords;
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++)
+        {
+            bool wall = !IsMazeCellWalkable(maze, x, y);
+            int faceCount = wall? 6 : 1;
+            float height = wall? wallHeight : 0.0f;
+
+            for (int f = 0; f < faceCount; f++)
+            {
+                for (int i = 0; i < 6; i++)
+                {
+                    const float *corner = cubeFaces[f][quadCorners[i]];
+
+                    vertices[0] = x + corner[0];
+                    vertices[1] = corner[1]*height;
+                    vertices[2] = y + corner[2];
+                    texcoords[0] = quadTexcoords[quadCorners[i]][0];
+                    texcoords[1] = quadTexcoords[quadCorners[i]][1];
+                    vertices += 3;
+                    texcoords += 2;
+                }
+            }
+        }
+    }
+
+    return mesh;
+}
+
+// Benchmark level file export and loading
+// NOTE: Items are placed on 1/256 of random cells, end-points are set on two maze corners
+// (cells restored once done), loading includes file mapping and maze cells generation
+static void BenchMazeFile(Maze maze, int samples, MazeRandom *random)
+{
+    double *exportTimes = (double *)malloc(samples*sizeof(double));
+    double *loadTimes = (double *)malloc(samples*sizeof(double));
+    unsigned int seed = (unsigned int)GetMazeRandomValue(random, 0, 0x7fffffff);
+    Point start = { 1, 1 };
+
+    int itemCount = maze.width*maze.height/256;
+    Point *items = (Point *)malloc(itemCount*sizeof(Point));
+
+    for (int i = 0; i < itemCount; i++) items[i] = (Point){ GetMazeRandomValue(random, 0, maze.width - 1), GetMazeRandomValue(random, 0, maze.height - 1) };
+
+    Point ends[2] = { { maze.width - 2, maze.height - 2 }, { 1, maze.height - 2 } };
+    int endCells[2] = { GetMazeCell(maze, ends[0].x, ends[0].y), GetMazeCell(maze, ends[1].x, ends[1].y) };
+
+    for (int i = 0; i < 2; i++) SetMazeCell(&maze, ends[i].x, ends[i].y, MAZE_CELL_END);
+
+    for (int s = 0; s < samples; s++)
+    {
+        double startTime = GetJobPoolTime();
+        ExportMaze(maze, items, itemCount, start, seed, BENCH_FILE);
+        exportTimes[s] = (GetJobPoolTime() - startTime)*1000.0;
+
+        startTime = GetJobPoolTime();
+        MazeFile file = LoadMazeFile(BENCH_FILE);
+        Maze loaded = LoadMazeFromFile(file);
+        loadTimes[s] = (GetJobPoolTime() - startTime)*1000.0;
+
+        UnloadMaze(loaded);
+        UnloadMazeFile(file);
+    }
+
+    if (!CheckMazeFileRoundTrip(maze, items, itemCount, start, seed))
+    {
+        printf("WARNING: Maze %ix%i level file round-trip generated a different level\n", maze.width, maze.height);
+        errorCount++;
+    }
+
+    for (int i = 1; i >= 0; i--) SetMazeCell(&maze, ends[i].x, ends[i].y, endCells[i]);
+
+    AddBenchResult(TextFormat("file_export/%i", maze.width), "ms", exportTimes, samples);
+    AddBenchResult(TextFormat("file_load/%i", maze.width), "ms", loadTimes, samples);
+
+    free(items);
+    free(exportTimes);
+    free(loadTimes);
+}
+
+// Check level file export and loading generate same maze, items, end-points, start and seed
+// NOTE: Maze must not contain item cells, items are only stored in items table
+static bool CheckMazeFileRoundTrip(Maze maze, const Point *items, int itemCount, Point start, unsigned int seed)
+{
+    if (!ExportMaze(maze, items, itemCount, start, seed, BENCH_FILE)) return false;
+
+    MazeFile file = LoadMazeFile(BENCH_FILE);
+    bool equal = IsMazeFileValid(file);
+
+    if (equal)
+    {
+        const MazeFileHeader *header = file.header;
+
+        equal = (header->width == maze.width) && (header->height == maze.height) && (header->startX == start.x) &&
+            (header->startY == start.y) && (header->seed == seed) && (header->itemCount == (unsigned int)itemCount);
+
+        for (int i = 0; equal && (i < itemCount); i++) equal = (file.items[i].x == items[i].x) && (file.items[i].y == items[i].y);
+
+        // End-points table must contain every maze end-point cell
+        int endCount = 0;
+
+        for (int y = 0; y < maze.height; y++)
+        {
+            for (int x = 0; x < maze.width; x++) endCount += (GetMazeCell(maze, x, y) == MAZE_CELL_END);
+        }
+
+        if (equal) equal = (header->endCount == (unsigned int)endCount);
+
+        for (unsigned int i = 0; equal && (i < header->endCount); i++) equal = (GetMazeCell(maze, file.ends[i].x, file.ends[i].y) == MAZE_CELL_END);
+    }
+
+    if (equal)
+    {
+        Maze loaded = LoadMazeFromFile(file);
+
+        equal = (loaded.width == maze.width) && (loaded.height == maze.height) && (GetMazeHash(loaded) == GetMazeHash(maze));
+
+        UnloadMaze(loaded);
+    }
+
+    UnloadMazeFile(file);
+    remove(BENCH_FILE);
+
+    return equal;
+}
+
+// Check truncated and corrupted level files are rejected
+// NOTE: Level file is exported and modified in memory, every modified file must be loaded as not valid
+static bool CheckMazeFileCorruption(Maze maze)
+{
+    if (!ExportMaze(maze, NULL, 0, (Point){ 1, 1 }, 0, BENCH_FILE)) return false;
+
+    int dataSize = 0;
+    unsigned char *data = LoadFileData(BENCH_FILE, &dataSize);
+    bool rejected = (data != NULL) && (dataSize > (int)sizeof(MazeFileHeader));
+
+    // Corruptions: truncated file (last byte, half file, header only part), invalid header fields
+    for (int c = 0; rejected && (c < 6); c++)
+    {
+        int size = dataSize;
+        unsigned char *corrupted = (unsigned char *)malloc(dataSize);
+        memcpy(corrupted, data, dataSize);
+
+        switch (c)
+        {
+            case 0: size = dataSize - 1; break;
+            case 1: size = dataSize/2; break;
+            case 2: size = (int)sizeof(MazeFileHeader)/2; break;
+            case 3: corrupted[0] = 'X'; break;
+            case 4: { int width = MAZE_MAX_SIZE + 1; memcpy(corrupted + offsetof(MazeFileHeader, width), &width, sizeof(int)); } break;
+            case 5: { unsigned int offset = 0xfffffff0; memcpy(corrupted + offsetof(MazeFileHeader, blocksOffset), &offset, sizeof(unsigned int)); } break;
+            default: break;
+        }
+
+        SaveFileData(BENCH_FILE, corrupted, size);
+        free(corrupted);
+
+        MazeFile file = LoadMazeFile(BENCH_FILE);
+
+        if (IsMazeFileValid(file))
+        {
+            printf("WARNING: Maze %ix%i level file corruption %i not detected\n", maze.width, maze.height, c);
+            rejected = false;
+        }
+
+        UnloadMazeFile(file);
+    }
+
+    UnloadFileData(data);
+    remove(BENCH_FILE);
+
+    return rejected;
+}
+
+// Benchmark maze image conversion and classification
+// NOTE: Image classification back into cells must generate the same maze
+static void BenchMazeImage(Maze maze, int samples)
+{
+    double *exportTimes = (double *)malloc(samples*sizeof(double));
+    double *importTimes = (double *)malloc(samples*sizeof(double));
+    unsigned int hash = GetMazeHash(maze);
+
+    for (int s = 0; s < samples; s++)
+    {
+        double startTime = GetJobPoolTime();
+        Image image = LoadImageFromMaze(maze);
+        exportTimes[s] = (GetJobPoolTime() - startTime)*1000.0;
+
+        startTime = GetJobPoolTime();
+        Maze imported = LoadMazeFromImage(image);
+        importTimes[s] = (GetJobPoolTime() - startTime)*1000.0;
+
+        if ((s == 0) && (GetMazeHash(imported) != hash))
+        {
+            printf("WARNING: Maze %ix%i image classification generated a different maze\n", maze.width, maze.height);
+            errorCount++;
+        }
+
+        UnloadMaze(imported);
+        UnloadImage(image);
+    }
+
+    AddBenchResult(TextFormat("image_export/%i", maze.width), "ms", exportTimes, samples);
+    AddBenchResult(TextFormat("image_import/%i", maze.width), "ms", importTimes, samples);
+
+    free(exportTimes);
+    free(importTimes);
+}
+
+// Benchmark bots swarm flow fields and update
+// NOTE: Items are placed on 1/256 of random cells, bots updated at simulation tick time,
+// final bots state must be equal to bots updated serially on calling thread
+static void BenchMazeSwarm(Maze maze, int samples, MazeRandom *random, JobPool *pool)
+{
+    double *times = (double *)malloc(samples*sizeof(double));
+    unsigned int seed = (unsigned int)GetMazeRandomValue(random, 0, 0x7fffffff);
+    Point endCell = { maze.width - 2, maze.height - 2 };
+
+    int itemCount = maze.width*maze.height/256;
+    MazeItems items = LoadMazeItems(itemCount);
+
+    for (int i = 0; i < itemCount; i++) AddMazeItem(&items, (Point){ GetMazeRandomValue(random, 0, maze.width - 1), GetMazeRandomValue(random, 0, maze.height - 1) });
+
+    MazeSwarm swarm = LoadMazeSwarm(maze, endCell, items, BENCH_SWARM_BOTS, seed, pool);
+    MazeSwarm serial = LoadMazeSwarm(maze, endCell, items, BENCH_SWARM_BOTS, seed, NULL);
+
+    // Flow fields loading, end-point and items goals
+    for (int s = 0; s < samples; s++)
+    {
+        double startTime = GetJobPoolTime();
+        UpdateMazeSwarmGoals(&swarm, maze, endCell, items, pool);
+        times[s] = (GetJobPoolTime() - startTime)*1000.0;
+    }
+
+    AddBenchResult(TextFormat("swarm_goals/%i", maze.width), "ms", times, samples);
+
+    // Bots update, parallel on job pool
+    for (int s = 0; s < samples; s++)
+    {
+        double startTime = GetJobPoolTime();
+        UpdateMazeSwarm(&swarm, maze, MAZE_SIM_TICK_TIME, pool);
+        times[s] = (GetJobPoolTime() - startTime)*1000000000.0/BENCH_SWARM_BOTS;
+
+        UpdateMazeSwarm(&serial, maze, MAZE_SIM_TICK_TIME, NULL);
+    }
+
+    AddBenchResult(TextFormat("swarm_update/%i/t%i", maze.width, GetJobPoolThreadCount(pool)), "ns", times, samples);
+
+    if ((GetMazeSwarmHash(swarm) != GetMazeSwarmHash(serial)) || (swarm.arrivals != serial.arrivals))
+    {
+        printf("WARNING: Maze %ix%i parallel swarm update is not equal to serial update\n", maze.width, maze.height);
+        errorCount++;
+    }
+
+    UnloadMazeSwarm(&swarm);
+    UnloadMazeSwarm(&serial);
+    UnloadMazeItems(items);
+    free(times);
+}
+
+// Benchmark editor journal edits recording, undo and redo
+// NOTE: Edits are done on a maze copy, every sample checks undo, redo and snapshot restore maze and items,
+// journal replay onto a regenerated maze is checked once, undoing replayed steps must restore regenerated maze
+static void BenchMazeJournal(Maze maze, int samples, MazeRandom *random)
+{
+    static const int strokeCells[4] = { MAZE_CELL_FLOOR, MAZE_CELL_WALL, MAZE_CELL_WALL, MAZE_CELL_END };
+
+    Maze edited = GenMazeEmpty(maze.width, maze.height);
+
+    if (edited.cells == NULL) return;
+
+    memcpy(edited.cells, maze.cells, (size_t)maze.chunksX*maze.chunksY*MAZE_CHUNK_CELLS);
+
+    double *editTimes = (double *)malloc(samples*sizeof(double));
+    double *undoTimes = (double *)malloc(samples*sizeof(double));
+    double *redoTimes = (double *)malloc(samples*sizeof(double));
+    MazeJournal journal = LoadMazeJournal(0);
+    MazeItems items = LoadMazeItems(BENCH_JOURNAL_STEPS);
+    int journalErrors = 0;
+
+    for (int i = 0; i < samples; i++)
+    {
+        unsigned int startHash = GetMazeHash(edited);
+        unsigned int startItemsHash = GetBenchItemsHash(items);
+        MazeJournalSnapshot snapshot = { 0 };
+        unsigned int snapshotHash = 0;
+        unsigned int snapshotItemsHash = 0;
+
+        // Edits, one to three strokes per step (steps modify the same cells several times),
+        // strokes could cross maze bounds, item toggled at every fourth step
+        double startTime = GetJobPoolTime();
+
+        for (int s = 0; s < BENCH_JOURNAL_STEPS; s++)
+        {
+            int strokes = GetMazeRandomValue(random, 1, 3);
+
+            for (int k = 0; k < strokes; k++)
+            {
+                Point start = { GetMazeRandomValue(random, 0, maze.width - 1), GetMazeRandomValue(random, 0, maze.height - 1) };
+                Point end = { start.x + GetMazeRandomValue(random, -16, 16), start.y + GetMazeRandomValue(random, -16, 16) };
+                Rectangle region = { (float)((start.x < end.x)? start.x : end.x), (float)((start.y < end.y)? start.y : end.y),
+                    (float)(abs(end.x - start.x) + 1), (float)(abs(end.y - start.y) + 1) };
+
+                BeginMazeJournalEdit(&journal, edited, region);
+                DrawMazeLine(&edited, start.x, start.y, end.x, end.y, strokeCells[GetMazeRandomValue(random, 0, 3)]);
+                EndMazeJournalEdit(&journal, edited);
+
+                if (((s % 4) == 0) && (k == 0))
+                {
+                    if (!RemoveMazeItem(&items, start)) AddMazeItem(&items, start);
+                    AddMazeJournalItem(&journal, start);
+                }
+            }
+
+            CloseMazeJournalStep(&journal);
+
+            if (s == (BENCH_JOURNAL_STEPS/2))
+            {
+                snapshot = TakeMazeJournalSnapshot(&journal);
+                snapshotHash = GetMazeHash(edited);
+                snapshotItemsHash = GetBenchItemsHash(items);
+            }
+        }
+
+        editTimes[i] = (GetJobPoolTime() - startTime)*1000.0;
+
+        unsigned int endHash = GetMazeHash(edited);
+        unsigned int endItemsHash = GetBenchItemsHash(items);
+
+        // Undo all steps, maze and items must be back to sample start
+        startTime = GetJobPoolTime();
+        while (journal.cursor > 0) UndoMazeJournalStep(&journal, &edited, &items);
+        undoTimes[i] = (GetJobPoolTime() - startTime)*1000.0;
+
+        if ((GetMazeHash(edited) != startHash) || (GetBenchItemsHash(items) != startItemsHash)) journalErrors++;
+
+        // Redo all steps, maze and items must be back to sample end
+        startTime = GetJobPoolTime();
+        while (journal.cursor < journal.stepCount) RedoMazeJournalStep(&journal, &edited, &items);
+        redoTimes[i] = (GetJobPoolTime() - startTime)*1000.0;
+
+        if ((GetMazeHash(edited) != endHash) || (GetBenchItemsHash(items) != endItemsHash)) journalErrors++;
+
+        // Snapshot restore, undoing steps after snapshot
+        RestoreMazeJournalSnapshot(&journal, &edited, &items, snapshot);
+
+        if ((GetMazeHash(edited) != snapshotHash) || (GetBenchItemsHash(items) != snapshotItemsHash)) journalErrors++;
+
+        // Next sample edits start from snapshot, steps after snapshot discarded
+        ClearMazeJournal(&journal);
+    }
+
+    // Replay onto a regenerated maze, undoing replayed steps must restore regenerated maze
+    // NOTE: Replay does not modify items, undo toggles items, so undo uses a separate items store
+    for (int s = 0; s < BENCH_JOURNAL_STEPS; s++)
+    {
+        Point start = { GetMazeRandomValue(random, 0, maze.width - 1), GetMazeRandomValue(random, 0, maze.height - 1) };
+        Point end = { start.x + GetMazeRandomValue(random, -16, 16), start.y + GetMazeRandomValue(random, -16, 16) };
+        Rectangle region = { (float)((start.x < end.x)? start.x : end.x), (float)((start.y < end.y)? start.y : end.y),
+            (float)(abs(end.x - start.x) + 1), (float)(abs(end.y - start.y) + 1) };
+
+        BeginMazeJournalEdit(&journal, edited, region);
+        DrawMazeLine(&edited, start.x, start.y, end.x, end.y, strokeCells[GetMazeRandomValue(random, 0, 3)]);
+        EndMazeJournalEdit(&journal, edited);
+        CloseMazeJournalStep(&journal);
+    }
+
+    Maze regenerated = GenMazeTiled(maze.width, maze.height, 4, 4, 0.75f, (unsigned int)GetMazeRandomValue(random, 0, 0x7fffffff), NULL);
+    MazeItems replayItems = LoadMazeItems(BENCH_JOURNAL_STEPS);
+
+    if (regenerated.cells != NULL)
+    {
+        unsigned int regeneratedHash = GetMazeHash(regenerated);
+
+        ReplayMazeJournal(&journal, &regenerated);
+        unsigned int replayedHash = GetMazeHash(regenerated);
+
+        while (journal.cursor > 0) UndoMazeJournalStep(&journal, &regenerated, &replayItems);
+        if (GetMazeHash(regenerated) != regeneratedHash) journalErrors++;
+
+        while (journal.cursor < journal.stepCount) RedoMazeJournalStep(&journal, &regenerated, &replayItems);
+        if (GetMazeHash(regenerated) != replayedHash) journalErrors++;
+    }
+
+    AddBenchResult(TextFormat("journal_edit/%i", maze.width), "ms", editTimes, samples);
+    AddBenchResult(TextFormat("journal_undo/%i", maze.width), "ms", undoTimes, samples);
+    AddBenchResult(TextFormat("journal_redo/%i", maze.width), "ms", redoTimes, samples);
+
+    if (journalErrors > 0) printf("WARNING: Maze %ix%i %i journal undo, redo, snapshot or replay checks failed\n", maze.width, maze.height, journalErrors);
+    errorCount += journalErrors;
+
+    UnloadMaze(regenerated);
+    UnloadMazeItems(replayItems);
+    UnloadMazeItems(items);
+    UnloadMazeJournal(&journal);
+    UnloadMaze(edited);
+    free(editTimes);
+    free(undoTimes);
+    free(redoTimes);
+}
+
+// Get items cells hash, independent of items order
+// NOTE: Items removal could reorder items, so cells hashes are added instead of chained
+static unsigned int GetBenchItemsHash(MazeItems items)
+{
+    unsigned int hash = (unsigned int)items.count;
+
+    for (int i = 0; i < items.count; i++)
+    {
+        unsigned int cell = ((unsigned int)items.cells[i].y << 16) | (unsigned int)items.cells[i].x;
+
+        cell ^= cell >> 15;
+        cell *= 0x2c1b3c6dU;
+        cell ^= cell >> 12;
+        hash += cell;
+    }
+
+    return hash;
+}
+
+// Benchmark maze tiled generation scaling
+// NOTE: Wall clock time is measured, several runs for every threads count
+static void BenchMazeGenScaling(int size, unsigned int seed, int maxThreads)
+{
+    const int runs = 3;
+    Maze reference = { 0 };
+    double times[3] = { 0 };
+
+    // Threads counts: powers of two and max threads
+    for (int threads = 1; threads <= maxThreads; threads = ((threads*2 > maxThreads) && (threads < maxThreads))? maxThreads : threads*2)
+    {
+        JobPool *pool = LoadJobPool(threads);
+
+        for (int run = 0; run < runs; run++)
+        {
+            double startTime = GetJobPoolTime();
+            Maze maze = GenMazeTiled(size, size, 4, 4, 0.75f, seed, pool);
+            times[run] = (GetJobPoolTime() - startTime)*1000.0;
+
+            if (reference.cells == NULL) reference = maze;
+            else
+            {
+                if (memcmp(reference.cells, maze.cells, (size_t)maze.chunksX*maze.chunksY*MAZE_CHUNK_CELLS) != 0)
+                {
+                    printf("WARNING: Tiled generation with %i threads generated a different maze\n", GetJobPoolThreadCount(pool));
+                    errorCount++;
+                }
+
+                UnloadMaze(maze);
+            }
+        }
+
+        AddBenchResult(TextFormat("gen_tiled/%i/t%i", size, GetJobPoolThreadCount(pool)), "ms", times, runs);
+
+        UnloadJobPool(pool);
+    }
+
+    UnloadMaze(reference);
+}
+
+// Check mazes with partial edge chunks (sizes not multiple of chunk size)
+// NOTE: Mazes get an end-point on last chunk, so every cell type tile is checked
+static void CheckMazeEdgeSizes(unsigned int seed)
+{
+    static const int sizes[3][2] = { { 8, 8 }, { 100, 70 }, { 100, 100 } };
+
+    for (int i = 0; i < 3; i++)
+    {
+        Maze maze = GenMazeTiled(sizes[i][0], sizes[i][1], 4, 4, 0.75f, seed, NULL);
+
+        if (maze.cells == NULL) continue;
+
+        SetMazeCell(&maze, maze.width - 2, maze.height - 2, MAZE_CELL_END);
+
+        // Last chunk tiles, region out of maze bounds clipped
+        Rectangle cells = { (float)((maze.chunksX - 1)*MAZE_CHUNK_SIZE), (float)((maze.chunksY - 1)*MAZE_CHUNK_SIZE), MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE };
+        Mesh tiles = GenMeshMazeTiles(maze, cells, (Vector2){ 0.0f, 0.0f }, 10.0f);
+
+        if (!CheckMazeTilesMesh(maze, cells, tiles, 10.0f))
+        {
+            printf("WARNING: Maze %ix%i last chunk tiles mesh not valid\n", maze.width, maze.height);
+            errorCount++;
+        }
+
+        UnloadMeshData(tiles);
+
+        // Level file round-trip, items on every walkable cell of last chunk row
+        Point items[MAZE_CHUNK_SIZE] = { 0 };
+        int itemCount = 0;
+        int itemsY = (maze.height - 1) & ~MAZE_CHUNK_MASK;
+
+        for (int x = 0; (x < maze.width) && (itemCount < MAZE_CHUNK_SIZE); x++)
+        {
+            if (IsMazeCellWalkable(maze, x, itemsY + 1)) items[itemCount++] = (Point){ x, itemsY + 1 };
+        }
+
+        if (!CheckMazeFileRoundTrip(maze, items, itemCount, (Point){ 1, 1 }, seed))
+        {
+            printf("WARNING: Maze %ix%i level file round-trip generated a different level\n", maze.width, maze.height);
+            errorCount++;
+        }
+
+        // NOTE: Rejected files loading warnings are expected, not reported
+        SetTraceLogLevel(LOG_ERROR);
+        if (!CheckMazeFileCorruption(maze)) errorCount++;
+        SetTraceLogLevel(LOG_WARNING);
+
+        UnloadMaze(maze);
+    }
+}
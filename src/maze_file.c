@@ -0,0 +1,288 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze level file module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_file.h"
+
+#include <stdio.h>      // Required for: FILE, fopen(), fwrite(), fclose()
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <string.h>     // Required for: memcmp(), memset()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_FILE_BLOCK_SIZE        (MAZE_CHUNK_CELLS/8)    // Walls block size in bytes, one bit per cell
+#define MAZE_FILE_BLOCK_ALIGNMENT   64                      // Walls blocks data alignment in file
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool PushMazeFilePoint(Point **points, int *count, int *capacity, Point point); // Add point to table, growing it if required
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze level file, memory-mapped (no data copied)
+// NOTE: File layout and chunks table are validated, an invalid file is unloaded
+MazeFile LoadMazeFile(const char *fileName)
+{
+    MazeFile file = { 0 };
+
+    file.mapping = LoadMappedFile(fileName);
+
+    if (file.mapping.data == NULL)
+    {
+        TraceLog(LOG_WARNING, "MAZE: [%s] Failed to open level file", fileName);
+        return file;
+    }
+
+    const MazeFileHeader *header = (const MazeFileHeader *)file.mapping.data;
+    bool valid = (file.mapping.size >= sizeof(MazeFileHeader)) && (memcmp(header->id, "MAZE", 4) == 0);
+
+    if (valid)
+    {
+        valid = (header->version <= MAZE_FILE_VERSION) && (header->headerSize >= sizeof(MazeFileHeader)) && ((header->headerSize%4) == 0) &&
+            (header->chunkSize == MAZE_CHUNK_SIZE) && (header->width > 0) && (header->height > 0) &&
+            (header->width <= MAZE_MAX_SIZE) && (header->height <= MAZE_MAX_SIZE);
+    }
+
+    if (valid)
+    {
+        // Check all file sections are inside file, using 64bit sizes to avoid overflows
+        unsigned long long chunkCount = (unsigned long long)((header->width + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE)*((header->height + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE);
+        unsigned long long tablesEnd = header->headerSize + chunkCount*4 + ((unsigned long long)header->itemCount + header->endCount)*8;
+        unsigned long long blocksEnd = header->blocksOffset + (unsigned long long)header->blockCount*MAZE_FILE_BLOCK_SIZE;
+
+        valid = (header->blocksOffset >= tablesEnd) && (blocksEnd <= file.mapping.size);
+
+        if (valid)
+        {
+            file.chunks = (const unsigned int *)(file.mapping.data + header->headerSize);
+            file.items = (const Point *)(file.chunks + chunkCount);
+            file.ends = file.items + header->itemCount;
+            file.blocks = file.mapping.data + header->blocksOffset;
+
+            for (unsigned long long i = 0; i < chunkCount; i++)
+            {
+                if (file.chunks[i] >= (MAZE_FILE_CHUNK_BLOCK + header->blockCount)) { valid = false; break; }
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "MAZE: [%s] Level file not valid", fileName);
+        UnloadMappedFile(file.mapping);
+        return (MazeFile){ 0 };
+    }
+
+    file.header = header;
+
+    TraceLog(LOG_INFO, "MAZE: [%s] Level file loaded successfully (%ix%i, version %i)", fileName, header->width, header->height, header->version);
+
+    return file;
+}
+
+// Unload maze level file
+void UnloadMazeFile(MazeFile file)
+{
+    UnloadMappedFile(file.mapping);
+}
+
+// Check if maze level file is valid (loaded and data consistent)
+bool IsMazeFileValid(MazeFile file)
+{
+    return (file.header != NULL);
+}
+
+// Check if maze level file cell is a wall, read in place
+// NOTE: Out of bounds cells are considered walls
+bool IsMazeFileWall(MazeFile file, int x, int y)
+{
+    if ((file.header == NULL) || (x < 0) || (y < 0) || (x >= file.header->width) || (y >= file.header->height)) return true;
+
+    int chunksX = (file.header->width + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE;
+    unsigned int entry = file.chunks[(y >> MAZE_CHUNK_SHIFT)*chunksX + (x >> MAZE_CHUNK_SHIFT)];
+
+    if (entry == MAZE_FILE_CHUNK_FLOOR) return false;
+    if (entry == MAZE_FILE_CHUNK_WALL) return true;
+
+    const unsigned char *block = file.blocks + (size_t)(entry - MAZE_FILE_CHUNK_BLOCK)*MAZE_FILE_BLOCK_SIZE;
+    int index = ((y & MAZE_CHUNK_MASK) << MAZE_CHUNK_SHIFT) + (x & MAZE_CHUNK_MASK);
+
+    return ((block[index >> 3] >> (index & 7)) & 1);
+}
+
+// Load maze cells from level file (walls and end-points)
+// NOTE: End-points out of maze bounds are ignored
+Maze LoadMazeFromFile(MazeFile file)
+{
+    if (file.header == NULL) return (Maze){ 0 };
+
+    Maze maze = GenMazeEmpty(file.header->width, file.header->height);
+
+    if (maze.cells == NULL) return maze;
+
+    // Decode walls, chunk by chunk
+    for (int cy = 0; cy < maze.chunksY; cy++)
+    {
+        for (int cx = 0; cx < maze.chunksX; cx++)
+        {
+            unsigned char *chunk = GetMazeChunk(maze, cx, cy);
+            unsigned int entry = file.chunks[cy*maze.chunksX + cx];
+
+            if (entry == MAZE_FILE_CHUNK_FLOOR) memset(chunk, MAZE_CELL_FLOOR, MAZE_CHUNK_CELLS);
+            else if (entry == MAZE_FILE_CHUNK_WALL) memset(chunk, MAZE_CELL_WALL, MAZE_CHUNK_CELLS);
+            else
+            {
+                const unsigned char *block = file.blocks + (size_t)(entry - MAZE_FILE_CHUNK_BLOCK)*MAZE_FILE_BLOCK_SIZE;
+
+                // NOTE: MAZE_CELL_FLOOR is 0 and MAZE_CELL_WALL is 1, cell value is the wall bit
+                for (int i = 0; i < MAZE_FILE_BLOCK_SIZE; i++)
+                {
+                    for (int bit = 0; bit < 8; bit++) chunk[i*8 + bit] = (block[i] >> bit) & 1;
+                }
+            }
+
+            // Chunk cells out of maze bounds are always walls
+            if ((cx == (maze.chunksX - 1)) || (cy == (maze.chunksY - 1)))
+            {
+                for (int y = 0; y < MAZE_CHUNK_SIZE; y++)
+                {
+                    for (int x = 0; x < MAZE_CHUNK_SIZE; x++)
+                    {
+                        if (((cx*MAZE_CHUNK_SIZE + x) >= maze.width) || ((cy*MAZE_CHUNK_SIZE + y) >= maze.height)) chunk[y*MAZE_CHUNK_SIZE + x] = MAZE_CELL_WALL;
+                    }
+                }
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < file.header->endCount; i++) SetMazeCell(&maze, file.ends[i].x, file.ends[i].y, MAZE_CELL_END);
+
+    return maze;
+}
+
+// Export maze and items to level file, end-points from maze cells
+// NOTE: Chunks without walls or full of walls do not store a walls block
+bool ExportMaze(Maze maze, const Point *items, int itemCount, Point start, unsigned int seed, const char *fileName)
+{
+    if (maze.cells == NULL) return false;
+
+    int chunkCount = maze.chunksX*maze.chunksY;
+    unsigned int *chunks = (unsigned int *)malloc(chunkCount*sizeof(unsigned int));
+    Point *ends = NULL;
+    int endCount = 0, endCapacity = 0;
+    unsigned int blockCount = 0;
+    bool success = (chunks != NULL);
+
+    // STEP 1: Classify chunks walls and collect end-points
+    for (int c = 0; (c < chunkCount) && success; c++)
+    {
+        const unsigned char *chunk = maze.cells + (size_t)c*MAZE_CHUNK_CELLS;
+        int wallCount = 0;
+
+        for (int i = 0; i < MAZE_CHUNK_CELLS; i++)
+        {
+            if (chunk[i] == MAZE_CELL_WALL) wallCount++;
+            else if (chunk[i] == MAZE_CELL_END)
+            {
+                Point cell = { (c%maze.chunksX)*MAZE_CHUNK_SIZE + (i & MAZE_CHUNK_MASK), (c/maze.chunksX)*MAZE_CHUNK_SIZE + (i >> MAZE_CHUNK_SHIFT) };
+                success = PushMazeFilePoint(&ends, &endCount, &endCapacity, cell);
+            }
+        }
+
+        if (wallCount == 0) chunks[c] = MAZE_FILE_CHUNK_FLOOR;
+        else if (wallCount == MAZE_CHUNK_CELLS) chunks[c] = MAZE_FILE_CHUNK_WALL;
+        else chunks[c] = MAZE_FILE_CHUNK_BLOCK + blockCount++;
+    }
+
+    if (itemCount < 0) itemCount = 0;
+
+    FILE *file = success? fopen(fileName, "wb") : NULL;
+
+    if (file != NULL)
+    {
+        // STEP 2: Write header and tables
+        unsigned int tablesEnd = (unsigned int)(sizeof(MazeFileHeader) + chunkCount*4 + (itemCount + endCount)*8);
+
+        MazeFileHeader header = { 0 };
+        memcpy(header.id, "MAZE", 4);
+        header.version = MAZE_FILE_VERSION;
+        header.headerSize = sizeof(MazeFileHeader);
+        header.width = maze.width;
+        header.height = maze.height;
+        header.chunkSize = MAZE_CHUNK_SIZE;
+        header.startX = start.x;
+        header.startY = start.y;
+        header.seed = seed;
+        header.itemCount = itemCount;
+        header.endCount = endCount;
+        header.blockCount = blockCount;
+        header.blocksOffset = (tablesEnd + MAZE_FILE_BLOCK_ALIGNMENT - 1)/MAZE_FILE_BLOCK_ALIGNMENT*MAZE_FILE_BLOCK_ALIGNMENT;
+
+        unsigned char padding[MAZE_FILE_BLOCK_ALIGNMENT] = { 0 };
+
+        success = (fwrite(&header, sizeof(MazeFileHeader), 1, file) == 1) &&
+            (fwrite(chunks, sizeof(unsigned int), chunkCount, file) == (size_t)chunkCount) &&
+            ((itemCount == 0) || (fwrite(items, sizeof(Point), itemCount, file) == (size_t)itemCount)) &&
+            ((endCount == 0) || (fwrite(ends, sizeof(Point), endCount, file) == (size_t)endCount)) &&
+            (fwrite(padding, 1, header.blocksOffset - tablesEnd, file) == (header.blocksOffset - tablesEnd));
+
+        // STEP 3: Write walls blocks, one bit per cell
+        unsigned char block[MAZE_FILE_BLOCK_SIZE] = { 0 };
+
+        for (int c = 0; (c < chunkCount) && success; c++)
+        {
+            if (chunks[c] < MAZE_FILE_CHUNK_BLOCK) continue;
+
+            const unsigned char *chunk = maze.cells + (size_t)c*MAZE_CHUNK_CELLS;
+
+            for (int i = 0; i < MAZE_FILE_BLOCK_SIZE; i++)
+            {
+                unsigned char bits = 0;
+                for (int bit = 0; bit < 8; bit++) bits |= (chunk[i*8 + bit] == MAZE_CELL_WALL) << bit;
+                block[i] = bits;
+            }
+
+            success = (fwrite(block, 1, MAZE_FILE_BLOCK_SIZE, file) == MAZE_FILE_BLOCK_SIZE);
+        }
+
+        success = (fclose(file) == 0) && success;
+    }
+    else success = false;
+
+    if (success) TraceLog(LOG_INFO, "MAZE: [%s] Level file saved successfully (%i walls blocks, %i items)", fileName, blockCount, itemCount);
+    else TraceLog(LOG_WARNING, "MAZE: [%s] Failed to save level file", fileName);
+
+    free(chunks);
+    free(ends);
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Add point to table, growing it if required
+static bool PushMazeFilePoint(Point **points, int *count, int *capacity, Point point)
+{
+    if (*count >= *capacity)
+    {
+        int newCapacity = (*capacity == 0)? 64 : *capacity*2;
+        Point *newPoints = (Point *)realloc(*points, newCapacity*sizeof(Point));
+
+        if (newPoints == NULL) return false;
+
+        *points = newPoints;
+        *capacity = newCapacity;
+    }
+
+    (*points)[(*count)++] = point;
+
+    return true;
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze level file module
+*
+*   Versioned binary level format (.maze), walls stored as a bit plane compressed by
+*   chunks, items and end-points stored as cell tables:
+*
+*       Offset  Size                Data
+*       0       64                  Header (MazeFileHeader)
+*       64      chunksCount*4       Chunks table, per chunk: MAZE_FILE_CHUNK_FLOOR,
+*                                   MAZE_FILE_CHUNK_WALL or walls block index + MAZE_FILE_CHUNK_BLOCK
+*       ...     itemCount*8         Items table, cells (x, y)
+*       ...     endCount*8          End-points table, cells (x, y)
+*       ...     blockCount*512      Walls blocks, aligned to 64 bytes, one bit per chunk cell,
+*                                   64 bits per row (bit 0 is first cell in row)
+*
+*   Level files are memory-mapped on loading: header, tables and walls are used in place,
+*   no data is copied until the maze is generated from the file with LoadMazeFromFile()
+*
+*   NOTE: Items are not stored in maze cells, items table is provided on export and it can
+*   be read from MazeFile.items on loading
+*
+*   NOTE: Multi-byte values are stored little-endian, big-endian platforms are not supported
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_FILE_H
+#define MAZE_FILE_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, Point
+#include "file_map.h"       // Required for: MappedFile
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_FILE_VERSION           1       // Current level file version
+
+#define MAZE_FILE_CHUNK_FLOOR       0       // Chunk table entry: chunk without walls
+#define MAZE_FILE_CHUNK_WALL        1       // Chunk table entry: chunk full of walls
+#define MAZE_FILE_CHUNK_BLOCK       2       // Chunk table entry: first walls block index
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze level file header, stored at file start
+typedef struct MazeFileHeader {
+    char id[4];                 // File identifier: "MAZE"
+    unsigned short version;     // File version (MAZE_FILE_VERSION)
+    unsigned short headerSize;  // Header size in bytes
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    int chunkSize;              // Chunk size in cells (MAZE_CHUNK_SIZE)
+    int startX;                 // Player start cell x
+    int startY;                 // Player start cell y
+    unsigned int seed;          // Maze generation seed (informative)
+    unsigned int itemCount;     // Items table count
+    unsigned int endCount;      // End-points table count
+    unsigned int blockCount;    // Walls blocks count
+    unsigned int blocksOffset;  // Walls blocks offset from file start
+    unsigned int reserved[4];   // Reserved for future versions
+} MazeFileHeader;
+
+// Maze level file, memory-mapped
+// NOTE: Pointers reference mapped file data, valid until file is unloaded
+typedef struct MazeFile {
+    MappedFile mapping;                 // File mapping
+    const MazeFileHeader *header;       // File header, NULL if file is not valid
+    const unsigned int *chunks;         // Chunks table
+    const Point *items;                 // Items table
+    const Point *ends;                  // End-points table
+    const unsigned char *blocks;        // Walls blocks
+} MazeFile;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeFile LoadMazeFile(const char *fileName);                // Load maze level file, memory-mapped (no data copied)
+void UnloadMazeFile(MazeFile file);                         // Unload maze level file
+bool IsMazeFileValid(MazeFile file);                        // Check if maze level file is valid (loaded and data consistent)
+bool IsMazeFileWall(MazeFile file, int x, int y);           // Check if maze level file cell is a wall, read in place
+Maze LoadMazeFromFile(MazeFile file);                       // Load maze cells from level file (walls and end-points)
+bool ExportMaze(Maze maze, const Point *items, int itemCount, Point start, unsigned int seed, const char *fileName); // Export maze and items to level file, end-points from maze cells
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_FILE_H
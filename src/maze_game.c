@@ -12,29 +12,83 @@
 ********************************************************************************************/
 
 #include "raylib.h"
-
-#include <stdlib.h>     // Required for: malloc(), free()
-
-#define MAZE_WIDTH          64
-#define MAZE_HEIGHT         64
+#include "raymath.h"    // Required for: Clamp(), Vector2Normalize(), Vector2Scale()
+
+#include "maze.h"       // Required for: Maze, Point, GenMaze(), GetMazeCell(), SetMazeCell()
+#include "maze_view.h"  // Required for: MazeView, DrawMazeViewTiles(), DrawMazeViewCells()
+#include "maze_tiles.h" // Required for: GetMazeTileAtlasRec()
+#include "maze_items.h" // Required for: MazeItems, AddMazeItem(), RemoveMazeItem(), ResetMazeItems()
+#include "maze_sim.h"   // Required for: MazeSim, InitMazeSim(), UpdateMazeSim(), GetMazeSimPlayerPosition()
+#include "maze_replay.h" // Required for: MazeReplay, StartMazeReplayRecording(), PlayMazeReplayInput()
+#include "maze_path.h"  // Required for: MazeDistanceField, GetMazeDistance(), GetMazeDistanceStep()
+#include "maze_file.h"  // Required for: LoadMazeFile(), LoadMazeFromFile(), ExportMaze()
+#include "job_pool.h"   // Required for: LoadJobPool(), UnloadJobPool()
+#include "frame_profiler.h" // Required for: FrameProfiler, BeginProfilerPhase(), EndProfilerPhase()
+#include "asset_loader.h" // Required for: Asset, LoadAssetLoader(), UpdateAssetLoader(), UnloadAssets()
+#include "maze_swarm.h" // Required for: LoadMazeSwarm(), UpdateMazeSwarm(), ScrollMazeSwarm(), DrawMazeSwarm()
+#include "maze_stream.h" // Required for: LoadMazeStream(), GenMazeStreamWindow(), ScrollMazeStreamWindow()
+#include "maze_model.h" // Required for: MazeModel, LoadMazeModel(), UpdateMazeModelCells(), DrawMazeModel()
+#include "maze_journal.h" // Required for: MazeJournal, BeginMazeJournalEdit(), UndoMazeJournalStep(), ReplayMazeJournal()
+
+#include <stdlib.h>     // Required for: atoi(), abs()
+#include <math.h>       // Required for: fminf(), fmaxf()
+
+#define MAZE_WIDTH          64      // Default maze width, can be changed at runtime
+#define MAZE_HEIGHT         64      // Default maze height, can be changed at runtime
 #define MAZE_SCALE          10.0f
+#define MAZE_POINT_CHANCE   0.75f   // Maze generation grid points chance, same for every generated maze
+#define MAZE_HINT_STEPS     8       // Path steps shown by hint arrows
+#define MAZE_LEVEL_FILE     "level.maze"    // Editor level file, saved/loaded with F5/F9
+#define MAZE_REPLAY_FILE    "session.mrpl"  // Game session replay file, recorded/played with F3/F4
+#define MAX_FRAME_SIM_TICKS 8       // Maximum simulation ticks per frame, slow frames slow down simulation
+#define PROFILER_FILE       "profiler.csv"  // Frame profiler records file, saved with F2
+#define RESOURCES_PATH      "resources"
+#define RESOURCES_PACK_FILE "resources/resources.rpak"  // Packed game assets, assets not packed are read from RESOURCES_PATH
+#define MAX_FRAME_ASSET_UPLOADS 1   // Maximum assets uploaded per loading state frame
+#define SWARM_BOT_COUNT     8192    // Bots spawned in swarm mode, toggled with B
+#define ENDLESS_WINDOW_ROWS (4*MAZE_CHUNK_SIZE) // Endless maze window height in cells, toggled with E
+#define ENDLESS_SCROLL_ROW  (2*MAZE_CHUNK_SIZE) // Endless maze window scrolled one chunk row once player reaches this row
+#define MODEL_WALL_HEIGHT   1.0f    // Maze 3d model walls height, in cells
+#define MODEL_CAMERA_DISTANCE 60.0f // Maze 3d view camera distance to player at zoom 1.0f, in cells
+
+// Game assets, loaded asynchronously at startup
+typedef enum {
+    GAME_ASSET_BIOME01 = 0,
+    GAME_ASSET_BIOME02,
+    GAME_ASSET_PLAYER,
+    GAME_ASSET_POINT_SFX,
+    GAME_ASSET_COUNT
+} GameAsset;
+
+// Main loop profiled phases
+typedef enum {
+    PHASE_UPDATE = 0,       // Input and game update
+    PHASE_EDIT,             // Editor input and maze edits
+    PHASE_UPLOAD,           // Maze view and model chunks GPU uploads (textures and meshes)
+    PHASE_DRAW_TILES,       // Maze drawing, in camera space
+    PHASE_DRAW_UI,          // UI text drawing, in screen space
+    PHASE_END_DRAWING,      // EndDrawing(), buffers swap and frame wait
+    PHASE_COUNT
+} FramePhase;
+
+// Add cells rectangle defined by two corner cells to region, an empty region has zero size
+// NOTE: Functions defined as static are internal to the module
+static Rectangle AddDirtyRegion(Rectangle region, Point start, Point end);
 
-#define MAX_MAZE_ITEMS      16
+// Draw hint arrow from one point to another
+static void DrawHintArrow(Vector2 start, Vector2 end, float size, Color color);
 
-// Declare new data type: Point
-typedef struct Point {
-    int x;
-    int y;
-} Point;
+// Get player input buttons from keyboard (MazeInputButton flags)
+static unsigned int GetPlayerInput(void);
 
-// Generate procedural maze image, using grid-based algorithm
-// NOTE: Functions defined as static are internal to the module
-static Image GenImageMaze(int width, int height, int spacingRows, int spacingCols, float pointChance);
+// Move maze view GPU upload time from a profiler phase to upload phase
+static void MoveViewUploadTime(FrameProfiler *profiler, MazeView *view, int phase);
+static void MoveModelUploadTime(FrameProfiler *profiler, MazeModel *model, int phase);
 
 //----------------------------------------------------------------------------------
 // Main entry point
 //----------------------------------------------------------------------------------
-int main(void)
+int main(int argc, char *argv[])
 {
     // Initialization
     //---------------------------------------------------------
@@ -44,385 +98,926 @@ int main(void)
     InitWindow(screenWidth, screenHeight, "Delivery04 - maze game");
     InitAudioDevice();
 
-    Sound sfx = LoadSound("resources/PointSFX.wav");
-    Sound song = LoadSound("resources/BackgroundMusic.wav");
+    // Game assets, files read (from resources pack if available) and decoded on a worker thread,
+    // while maze is generated and loading state is drawn, GPU textures and sounds are created on main thread
+    Asset assets[GAME_ASSET_COUNT] = {
+        { "maze_biome01.png", ASSET_TEXTURE },
+        { "maze_biome02.png", ASSET_TEXTURE },
+        { "player.png", ASSET_TEXTURE },
+        { "PointSFX.wav", ASSET_SOUND }
+    };
+    AssetLoader *assetLoader = LoadAssetLoader(RESOURCES_PATH, RESOURCES_PACK_FILE, assets, GAME_ASSET_COUNT);
+
+    // Background music, streamed from file in small buffers instead of fully decoded in memory
+    Music music = LoadMusicStream("resources/BackgroundMusic.wav");
 
     // Current application mode
     int currentMode = 1;    // 0-Game, 1-Editor
 
     // Random seed defines the random numbers generation,
     // always the same if using the same seed
+    // NOTE: Maze generation uses its own random generators, seeded with current seed,
+    // raylib random state is only used to select next seed
     int seed = 92683;
     SetRandomSeed(seed);
 
-    // Generate maze image using the grid-based generator
-    // TODO: [1p] Implement GenImageMaze() function with required parameters
-    Image imMaze = GenImageMaze(MAZE_WIDTH, MAZE_HEIGHT, 4, 4, 0.75f);
+    // Job pool for maze generation, using all CPU cores
+    JobPool *jobPool = LoadJobPool(0);
 
-    // Load a texture to be drawn on screen from our image data
-    // WARNING: If imMaze pixel data is modified, texMaze needs to be re-loaded
-    Texture texMaze = LoadTextureFromImage(imMaze);
+    // Maze size, it can be provided as command line arguments: maze_game [width height]
+    int mazeWidth = MAZE_WIDTH;
+    int mazeHeight = MAZE_HEIGHT;
 
-    // Player start-position and end-position initialization
-    Point startCell = { 2, 2 };
-    Point endCell = { imMaze.width - 2, imMaze.height - 2 };
+    if (argc > 2)
+    {
+        mazeWidth = (int)Clamp((float)atoi(argv[1]), 8, MAZE_MAX_SIZE);
+        mazeHeight = (int)Clamp((float)atoi(argv[2]), 8, MAZE_MAX_SIZE);
+    }
 
-    // Maze drawing position (editor mode)
-    Vector2 mazePosition = {
-        GetScreenWidth()/2 - texMaze.width*MAZE_SCALE/2,
-        GetScreenHeight()/2 - texMaze.height*MAZE_SCALE/2
-    };
+    // Generate maze cells using the grid-based generator, by tiles in parallel
+    Maze maze = GenMazeTiled(mazeWidth, mazeHeight, 4, 4, MAZE_POINT_CHANCE, (unsigned int)seed, jobPool);
 
-    // Define player position and size
-    Rectangle player = { mazePosition.x + startCell.x * MAZE_SCALE, mazePosition.y + startCell.y * MAZE_SCALE, 1, 1 };
+    // Player start-position and end-position initialization
+    Point startCell = { 2, 2 };
+    Point endCell = { maze.width - 2, maze.height - 2 };
 
+    // Maze drawing position, centered on screen
     Vector2 position = {
-        screenWidth / 2 - imMaze.width * MAZE_SCALE / 2,
-        screenHeight / 2 - imMaze.height * MAZE_SCALE / 2
+        screenWidth / 2 - maze.width * MAZE_SCALE / 2,
+        screenHeight / 2 - maze.height * MAZE_SCALE / 2
     };
 
+    // Maze view, only visible maze chunks are loaded and drawn
+    // WARNING: If maze cells data is modified, view must be updated with UpdateMazeViewCells()
+    MazeView view = LoadMazeView(maze, position, MAZE_SCALE);
+
+    // Distance field to end-point, used for hints and maze solvability check
+    // WARNING: If maze cells data is modified, field must be updated with UpdateMazeDistanceField()
+    MazeDistanceField goalField = LoadMazeDistanceField(maze, endCell);
+    bool showHint = false;
+
+    // Maze 3d model, only chunks around player are loaded and drawn, toggled with TAB
+    // WARNING: If maze cells data is modified, model must be updated with UpdateMazeModelCells()
+    MazeModel model = LoadMazeModel(maze, MODEL_WALL_HEIGHT);
+    bool showModel = false;
+
+    // Editor undo/redo journal, maze edits stored as cells deltas, replayed when a new seed is generated
+    // NOTE: Snapshot is a journal position, restoring it undoes/redoes edits, no maze copy is kept
+    MazeJournal journal = LoadMazeJournal(1024);
+    MazeJournalSnapshot snapshot = { 0 };
+
+    // Game simulation, stepped at a fixed tick rate, independent of rendering frame rate
+    // NOTE: Player is drawn interpolated between last two simulation ticks
+    MazeSim sim = InitMazeSim(startCell, endCell);
+    float simAccumulator = 0.0f;
+    Vector2 playerPosition = { position.x + startCell.x * MAZE_SCALE, position.y + startCell.y * MAZE_SCALE };
+
+    // Game session replay, per-tick input recorded from game start and played back
+    // NOTE: Playback measures frame and simulation update times for the recorded inputs
+    MazeReplay replay = { 0 };
+    int replayState = 0;        // 0-None, 1-Recording, 2-Playing
+    int replayResult = 0;       // Last playback result: 0-None, 1-State equal, -1-State mismatch
+    int replayFrameCount = 0;
+    double replayFrameTime = 0.0;
+    double replayUpdateTime = 0.0;
+
+    // Bots swarm mode, bots navigating to end-point or items, updated every simulation tick
+    // WARNING: If maze cells, end-point or items are modified, swarm goals must be updated
+    MazeSwarm swarm = { 0 };
+    MazeSwarmBatch swarmBatch = { 0 };
+    bool swarmMode = false;
+    bool swarmGoalsDirty = false;
+
+    // Endless maze mode, maze window generated row by row ahead of player, rows behind evicted
+    // NOTE: Window rows are generated by a streaming generator, memory only depends on maze width
+    MazeStream stream = { 0 };
+    bool endlessMode = false;
+
     // Camera 2D for 2d gameplay mode
     // TODO: [2p] Initialize camera parameters as required
     Camera2D camera = { 0 };
-    camera.target = (Vector2){ player.x + 20.0f, player.y + 20.0f };
+    camera.target = (Vector2){ playerPosition.x + 20.0f, playerPosition.y + 20.0f };
     camera.offset = (Vector2){ screenWidth / 2.0f, screenHeight / 2.0f };
     camera.rotation = 0.0f;
     camera.zoom = 5.0f;
 
+    // Camera 3D for 3d view game mode, looking down to player from behind
+    // NOTE: Camera distance uses 2d camera zoom, so both views zoom the same way
+    Camera3D camera3d = { 0 };
+    camera3d.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera3d.fovy = 45.0f;
+    camera3d.projection = CAMERA_PERSPECTIVE;
+
+    // Camera 2D for editor mode, mouse wheel zoom and middle button panning
+    // NOTE: Default camera shows the maze centered on screen, at MAZE_SCALE
+    Camera2D editorCamera = { 0 };
+    editorCamera.zoom = 1.0f;
+
     // Mouse selected cell for maze editing
     Point selectedCell = { 0 };
 
-    // Maze items position and state
-    Point mazeItems[MAX_MAZE_ITEMS] = { 0 };
-    bool mazeItemPicked[MAX_MAZE_ITEMS] = { 0 };
-    
+    // Editor stroke state, previous frame brush cell and button (-1 if none)
+    Point strokeCell = { 0 };
+    int strokeButton = -1;
+
+    // Maze items position and state, indexed by cell
+    // NOTE: Items are not stored in maze cells, walls data is not modified by items
+    MazeItems items = LoadMazeItems(64);
+
     // Define textures to be used as our "biomes"
+    // NOTE: Textures are set once assets loading is finished
     Texture texBiomes[4] = { 0 };
-    texBiomes[0] = LoadTexture("resources/maze_biome01.png");
-    texBiomes[1] = LoadTexture("resources/maze_biome02.png");
     //texBiomes[2] = LoadTexture("resources/maze_biome03.png");
 
     // TODO: Load additional textures for different biomes
     int currentBiome = 0;
 
     // TODO: Define all variables required for game UI elements (sprites, fonts...)
-    Texture texPlayer = LoadTexture("resources/player.png");
+    Texture texPlayer = { 0 };
+    Sound sfx = { 0 };
     Rectangle sourceRec = { 6, 2, 26, 31 };
-    int playerScore = 0;
+
+    // Frame profiler, main loop phases timing, overlay toggled with F1
+    const char *phaseNames[PHASE_COUNT] = { "update", "edit", "upload", "tiles", "ui", "end" };
+    FrameProfiler profiler = LoadFrameProfiler(phaseNames, PHASE_COUNT);
+    bool showProfiler = false;
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
-    //--------------------------------------------------------------------------------------
-    // 
+
     //Reproductor Musica
-    PlaySound(song);
+    PlayMusicStream(music);
+
+    // Loading state, waiting for assets decoding, decoded assets uploaded a few per frame
+    // NOTE: Music stream buffers must be refilled every frame, also while loading
+    while (!WindowShouldClose() && !UpdateAssetLoader(assetLoader, MAX_FRAME_ASSET_UPLOADS))
+    {
+        UpdateMusicStream(music);
+
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("LOADING...", screenWidth/2 - MeasureText("LOADING...", 40)/2, screenHeight/2 - 40, 40, DARKGRAY);
+            DrawRectangle(screenWidth/2 - 200, screenHeight/2 + 20, (int)(400*GetAssetLoaderProgress(assetLoader)), 12, DARKGRAY);
+            DrawRectangleLines(screenWidth/2 - 200, screenHeight/2 + 20, 400, 12, GRAY);
+
+        EndDrawing();
+    }
+
+    UnloadAssetLoader(assetLoader);
+
+    texBiomes[0] = assets[GAME_ASSET_BIOME01].texture;
+    texBiomes[1] = assets[GAME_ASSET_BIOME02].texture;
+    texPlayer = assets[GAME_ASSET_PLAYER].texture;
+    sfx = assets[GAME_ASSET_POINT_SFX].sound;
+    //--------------------------------------------------------------------------------------
 
     // Main game loop
     while (!WindowShouldClose())    // Detect window close button or ESC key
     {
         // Update
         //----------------------------------------------------------------------------------
+        double frameStartTime = GetTime();
+
+        BeginProfilerFrame(&profiler);
+        BeginProfilerPhase(&profiler, PHASE_UPDATE);
+
+        UpdateMusicStream(music);
+
+        if (IsKeyPressed(KEY_F1)) showProfiler = !showProfiler;
+        if (IsKeyPressed(KEY_F2)) ExportFrameProfiler(&profiler, PROFILER_FILE);
+
+        // Endless maze mode toggle, only in game mode, not while replay is recording or playing
+        bool endlessToggle = (currentMode == 0) && (replayState == 0) && IsKeyPressed(KEY_E);
+
         // Select current mode as desired
+        if (IsKeyPressed(KEY_SPACE))
+        {
+            // Endless maze mode is game mode only, regular maze restored before editing
+            if (endlessMode) endlessToggle = true;
+
+            currentMode = !currentMode; // Toggle mode: 0-Game, 1-Editor
+            swarmGoalsDirty = true;     // Maze could be modified in editor mode
+
+            // Replay recording is saved and playback is cancelled when leaving game mode
+            if (replayState == 1)
+            {
+                StopMazeReplayRecording(&replay, sim);
+                ExportMazeReplay(replay, MAZE_REPLAY_FILE);
+            }
 
-        
+            UnloadMazeReplay(replay);
+            replay = (MazeReplay){ 0 };
+            replayState = 0;
+        }
+
+        // Maze replaced, maze view and distance field must be reloaded
+        // NOTE: Editor journal is cleared unless its edits were replayed onto the new maze
+        bool mazeReloaded = false;
+        bool journalReplayed = false;
 
-        if (IsKeyPressed(KEY_SPACE)) currentMode = !currentMode; // Toggle mode: 0-Game, 1-Editor
+        if (endlessToggle)
+        {
+            endlessMode = !endlessMode;
+            UnloadMaze(maze);
+
+            if (endlessMode)
+            {
+                // Endless maze has no end-point or items, maze width made odd for streaming generator
+                stream = LoadMazeStream((mazeWidth - 1) | 1, (unsigned int)seed);
+                maze = GenMazeStreamWindow(&stream, ENDLESS_WINDOW_ROWS);
+                startCell = (Point){ 1, 1 };
+                endCell = (Point){ -1, -1 };
+                ClearMazeItems(&items);
+            }
+            else
+            {
+                UnloadMazeStream(&stream);
+                maze = GenMazeTiled(mazeWidth, mazeHeight, 4, 4, MAZE_POINT_CHANCE, (unsigned int)seed, jobPool);
+                startCell = (Point){ 2, 2 };
+                endCell = (Point){ maze.width - 2, maze.height - 2 };
+            }
+
+            mazeReloaded = true;
+        }
 
         if (currentMode == 0) // Game mode
         {
             // TODO: [2p] Player 2D movement from predefined Start-point to End-point
             // Implement maze 2D player movement logic (cursors || WASD)
-            
-            float velocity = 1 * MAZE_SCALE;
-            Vector2 direction = { 0 };
-
-            if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) direction = (Vector2) { velocity, 0 };
-            else if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) direction = (Vector2){ -velocity, 0 };
-            else if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) direction = (Vector2){ 0, velocity };
-            else if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) direction = (Vector2){ 0, -velocity };
-            
-            // Use imMaze pixel information to check collisions
+            // NOTE: Movement, collisions, items pickup and end-point detection are simulated
+            // in fixed ticks, frame time is accumulated and consumed by ticks
+            if (IsKeyPressed(KEY_H)) showHint = !showHint;
+            if (IsKeyPressed(KEY_TAB)) showModel = !showModel;
 
-            if (!ColorIsEqual(GetImageColor(imMaze,
-                (int)((player.x + direction.x - position.x) / MAZE_SCALE),
-                (int)((player.y + direction.y - position.y) / MAZE_SCALE)), WHITE))
+            // Toggle bots swarm mode, bots spawned at random walkable cells
+            if (IsKeyPressed(KEY_B))
             {
-                player.x += direction.x;
-                player.y += direction.y;
+                swarmMode = !swarmMode;
+
+                if (swarmMode)
+                {
+                    swarm = LoadMazeSwarm(maze, endCell, items, SWARM_BOT_COUNT, (unsigned int)seed, jobPool);
+                    swarmBatch = LoadMazeSwarmBatch(swarm);
+                    swarmGoalsDirty = false;
+                }
+                else
+                {
+                    UnloadMazeSwarm(&swarm);
+                    UnloadMazeSwarmBatch(&swarmBatch);
+                }
             }
 
-            // Detect if current playerCell == endCell to finish game
+            // Restart game once finished, items are placed again
+            if (sim.finished && (replayState != 2) && IsKeyPressed(KEY_ENTER))
+            {
+                sim = InitMazeSim(startCell, endCell);
+                ResetMazeItems(&items);
+                simAccumulator = 0.0f;
+                swarmGoalsDirty = true;
+            }
 
-            if (player.x == endCell.x && player.y == endCell.y)
+            // Replay recording, game restarted from start-point, recording stops on F3 or game finished
+            if (IsKeyPressed(KEY_F3) && (replayState != 2) && !endlessMode)
+            {
+                if (replayState == 1)
+                {
+                    StopMazeReplayRecording(&replay, sim);
+                    ExportMazeReplay(replay, MAZE_REPLAY_FILE);
+                    UnloadMazeReplay(replay);
+                    replay = (MazeReplay){ 0 };
+                    replayState = 0;
+                }
+                else
+                {
+                    sim = InitMazeSim(startCell, endCell);
+                    ResetMazeItems(&items);
+                    simAccumulator = 0.0f;
+                    swarmGoalsDirty = true;
+
+                    replay = StartMazeReplayRecording(maze, items, sim, (unsigned int)seed);
+                    replayState = 1;
+                    replayResult = 0;
+                }
+            }
+            else if (IsKeyPressed(KEY_F4) && (replayState == 0) && !endlessMode)
             {
-                // TODO: Finish game
-                CloseWindow();
+                // Replay playback, maze generated again from replay seed if not the current maze
+                replay = LoadMazeReplay(MAZE_REPLAY_FILE);
+
+                if (IsMazeReplayValid(replay) && (GetMazeHash(maze) != replay.header.mazeHash))
+                {
+                    UnloadMaze(maze);
+                    maze = GenMazeTiled(replay.header.width, replay.header.height, 4, 4, MAZE_POINT_CHANCE, replay.header.seed, jobPool);
+                    mazeWidth = maze.width;
+                    mazeHeight = maze.height;
+                    seed = (int)replay.header.seed;
+                    mazeReloaded = true;
+
+                    if (GetMazeHash(maze) != replay.header.mazeHash)
+                    {
+                        TraceLog(LOG_WARNING, "REPLAY: Replay maze can not be generated from seed %u", replay.header.seed);
+                        UnloadMazeReplay(replay);
+                        replay = (MazeReplay){ 0 };
+                    }
+                }
+
+                if (IsMazeReplayValid(replay))
+                {
+                    startCell = (Point){ replay.header.startX, replay.header.startY };
+                    endCell = (Point){ replay.header.endX, replay.header.endY };
+
+                    ClearMazeItems(&items);
+                    for (unsigned int i = 0; i < replay.header.itemCount; i++) AddMazeItem(&items, replay.items[i]);
+
+                    mazeReloaded = true;
+                    replayState = 2;
+                    replayResult = 0;
+                    replayFrameCount = 0;
+                    replayFrameTime = 0.0;
+                    replayUpdateTime = 0.0;
+                }
             }
 
-            // TODO: [1p] Camera 2D system following player movement around the map
-            // Update Camera2D parameters as required to follow player and zoom control
-            // Update camera target position with new player position
-            camera.target = (Vector2){ player.x + 2, player.y + 2 };
-            camera.zoom += ((float)GetMouseWheelMove()*0.05f);
-
-            // TODO: [2p] Maze items pickup logic
-            if (ColorIsEqual(GetImageColor(imMaze, player.x, player.y), RED)) {
-                playerScore += 1;
-                PlaySound(sfx);
-                /*for (int i = 0; i < MAX_MAZE_ITEMS; i++) {
-                    Point Item = mazeItems[i];
-                    if (Item.x == player.x && Item.y == player.y) {
-                        mazeItemPicked[i] = false;
+            unsigned int input = GetPlayerInput();
+            int tickCount = 0;
+
+            simAccumulator += GetFrameTime();
+
+            bool replayPlaying = (replayState == 2);
+            double updateStartTime = GetTime();
+
+            // NOTE: Simulation starts next frame if maze has been reloaded
+            while (!mazeReloaded && (simAccumulator >= MAZE_SIM_TICK_TIME) && (tickCount < MAX_FRAME_SIM_TICKS))
+            {
+                unsigned int tickInput = (replayState == 2)? PlayMazeReplayInput(&replay) : input;
+
+                UpdateMazeSim(&sim, maze, &items, tickInput);
+                simAccumulator -= MAZE_SIM_TICK_TIME;
+                tickCount++;
+
+                if (sim.events & MAZE_SIM_EVENT_ITEM_PICKED)
+                {
+                    PlaySound(sfx);
+                    swarmGoalsDirty = true;
+                }
+
+                // Bots swarm update, flow fields updated first if goals changed
+                if (swarmMode)
+                {
+                    if (swarmGoalsDirty) UpdateMazeSwarmGoals(&swarm, maze, endCell, items, jobPool);
+                    swarmGoalsDirty = false;
+
+                    UpdateMazeSwarm(&swarm, maze, MAZE_SIM_TICK_TIME, jobPool);
+                }
+
+                if (replayState == 1)
+                {
+                    RecordMazeReplayInput(&replay, tickInput);
+
+                    if (sim.finished)
+                    {
+                        StopMazeReplayRecording(&replay, sim);
+                        ExportMazeReplay(replay, MAZE_REPLAY_FILE);
+                        UnloadMazeReplay(replay);
+                        replay = (MazeReplay){ 0 };
+                        replayState = 0;
                     }
-                }*/
+                }
+                else if ((replayState == 2) && IsMazeReplayFinished(replay))
+                {
+                    replayResult = IsMazeReplayStateEqual(replay, sim)? 1 : -1;
+                    replayState = 0;
+                    break;
+                }
+            }
+
+            // Endless maze window scrolled one chunk row, new rows generated ahead of player
+            // NOTE: Player cell is moved up with maze rows, camera follows player so scroll is not visible
+            if (endlessMode && (sim.playerCell.y >= ENDLESS_SCROLL_ROW))
+            {
+                ScrollMazeStreamWindow(&stream, &maze, 1);
+                ClearMazeJournal(&journal);     // Journal cells coordinates not valid after scrolling
+
+                sim.playerCell.y -= MAZE_CHUNK_SIZE;
+                sim.previousCell.y -= MAZE_CHUNK_SIZE;
+                ScrollMazeSwarm(&swarm, maze, MAZE_CHUNK_SIZE);
+
+                UpdateMazeViewCells(&view, maze, (Rectangle){ 0, 0, (float)maze.width, (float)maze.height });
+                UpdateMazeModelCells(&model, maze, (Rectangle){ 0, 0, (float)maze.width, (float)maze.height });
+                UpdateMazeDistanceField(&goalField, maze, (Rectangle){ 0, 0, (float)maze.width, (float)maze.height });
+                swarmGoalsDirty = true;
+
+                // NOTE: Scrolled chunks are uploaded inside update phase, not drawing phase
+                MoveViewUploadTime(&profiler, &view, PHASE_UPDATE);
+                MoveModelUploadTime(&profiler, &model, PHASE_UPDATE);
+            }
+
+            // Drop time not simulated on slow frames, avoiding ticks to accumulate
+            if (simAccumulator >= MAZE_SIM_TICK_TIME) simAccumulator = 0.0f;
+
+            if (replayPlaying) replayUpdateTime += GetTime() - updateStartTime;
+
+            // Replay playback finished, report measured times
+            if (replayPlaying && (replayState == 0))
+            {
+                TraceLog((replayResult == 1)? LOG_INFO : LOG_WARNING, "REPLAY: Playback %s: %u ticks, %.3f ms/frame average (%i frames), %.3f us/tick update average",
+                    (replayResult == 1)? "state equal" : "state mismatch", replay.header.tickCount, replayFrameTime*1000.0/((replayFrameCount > 0)? replayFrameCount : 1),
+                    replayFrameCount, replayUpdateTime*1000000.0/((replay.header.tickCount > 0)? replay.header.tickCount : 1));
+
+                UnloadMazeReplay(replay);
+                replay = (MazeReplay){ 0 };
             }
         }
         else if (currentMode == 1) // Editor mode
         {
-            if (IsKeyPressed(KEY_R))
+            EndProfilerPhase(&profiler, PHASE_UPDATE);
+            BeginProfilerPhase(&profiler, PHASE_EDIT);
+
+            bool regenerate = IsKeyPressed(KEY_R);
+
+            // Change maze size, a new maze is generated
+            if (IsKeyPressed(KEY_PAGE_UP) && ((mazeWidth < MAZE_MAX_SIZE) || (mazeHeight < MAZE_MAX_SIZE)))
             {
-                seed += GetRandomValue(1, 99);
-                UnloadImage(imMaze);
-                UnloadTexture(texMaze);
-                imMaze = GenImageMaze(MAZE_WIDTH, MAZE_HEIGHT, 4, 4, 0.5f);
-                texMaze = LoadTextureFromImage(imMaze);
+                mazeWidth = (mazeWidth*2 > MAZE_MAX_SIZE)? MAZE_MAX_SIZE : mazeWidth*2;
+                mazeHeight = (mazeHeight*2 > MAZE_MAX_SIZE)? MAZE_MAX_SIZE : mazeHeight*2;
+                regenerate = true;
+            }
+            else if (IsKeyPressed(KEY_PAGE_DOWN) && ((mazeWidth > 8) || (mazeHeight > 8)))
+            {
+                mazeWidth = (mazeWidth/2 < 8)? 8 : mazeWidth/2;
+                mazeHeight = (mazeHeight/2 < 8)? 8 : mazeHeight/2;
+                regenerate = true;
             }
 
-            // TODO: [2p] Maze editor mode, edit image pixels with mouse.
-            
-            // Implement logic to select image cell from mouse position -> TIP: GetMousePosition()
-            // NOTE: Mouse position is returned in screen coordinates and it has to 
-            // transformed into image coordinates
-            // Once the cell is selected, if mouse button pressed add/remove image pixels
-
-            // WARNING: Remember that when imMaze changes, texMaze must be also updated!
+            if (regenerate)
+            {
+                seed += GetRandomValue(1, 99);
+                UnloadMaze(maze);
+                maze = GenMazeTiled(mazeWidth, mazeHeight, 4, 4, MAZE_POINT_CHANCE, (unsigned int)seed, jobPool);
+                endCell = (Point){ maze.width - 2, maze.height - 2 };
+
+                // Manual edits kept, replayed onto new maze (edits out of new maze size are dropped)
+                ReplayMazeJournal(&journal, &maze);
+                journalReplayed = true;
+                mazeReloaded = true;
+            }
 
-            // Set Walkable Position
-            if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
+            // Save/load maze level file: walls, items, start-point and end-points
+            if (IsKeyPressed(KEY_F5)) ExportMaze(maze, items.cells, items.count, startCell, (unsigned int)seed, MAZE_LEVEL_FILE);
+            else if (IsKeyPressed(KEY_F9))
             {
-                Vector2 mousePos = GetMousePosition();
+                MazeFile levelFile = LoadMazeFile(MAZE_LEVEL_FILE);
 
-                if ((mousePos.x >= position.x) && (mousePos.y >= position.y))
+                if (IsMazeFileValid(levelFile))
                 {
-                    Point mapCoord = {
-                        (int)((mousePos.x - position.x) / MAZE_SCALE),
-                        (int)((mousePos.y - position.y) / MAZE_SCALE),
-                    };
+                    UnloadMaze(maze);
+                    maze = LoadMazeFromFile(levelFile);
+                    mazeWidth = maze.width;
+                    mazeHeight = maze.height;
+                    seed = (int)levelFile.header->seed;
 
-                    ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, BLACK);
+                    startCell = (Point){ levelFile.header->startX, levelFile.header->startY };
+                    if (levelFile.header->endCount > 0) endCell = levelFile.ends[0];
+                    else endCell = (Point){ maze.width - 2, maze.height - 2 };
 
-                    UnloadTexture(texMaze);
-                    texMaze = LoadTextureFromImage(imMaze);
+                    ClearMazeItems(&items);
+                    for (unsigned int i = 0; i < levelFile.header->itemCount; i++) AddMazeItem(&items, levelFile.items[i]);
+
+                    mazeReloaded = true;
                 }
+
+                UnloadMazeFile(levelFile);
             }
 
+            // Import externally painted maze image, dropped on window (one pixel per cell)
+            // NOTE: Image colors use maze color scheme, RED cells are added as items
+            if (IsFileDropped())
+            {
+                FilePathList droppedFiles = LoadDroppedFiles();
 
-            if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT)) {
-                // Set End-Point Position
-                if (IsKeyDown(KEY_LEFT_CONTROL)) {
-                    Vector2 mousePos = GetMousePosition();
+                if ((droppedFiles.count > 0) && IsFileExtension(droppedFiles.paths[0], ".png"))
+                {
+                    Image image = LoadImage(droppedFiles.paths[0]);
+                    Maze imported = LoadMazeFromImage(image);
+                    UnloadImage(image);
 
-                    if ((mousePos.x >= position.x) && (mousePos.y >= position.y))
+                    if ((imported.cells != NULL) && (imported.width >= 8) && (imported.height >= 8))
                     {
-                        Point mapCoord = {
-                            (int)((mousePos.x - position.x) / MAZE_SCALE),
-                            (int)((mousePos.y - position.y) / MAZE_SCALE),
-                        };
-
-                        ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, GREEN);
+                        UnloadMaze(maze);
+                        maze = imported;
+                        mazeWidth = maze.width;
+                        mazeHeight = maze.height;
+                        startCell = (Point){ 2, 2 };
+                        endCell = (Point){ maze.width - 2, maze.height - 2 };
+
+                        ClearMazeItems(&items);
+                        for (int y = 0; y < maze.height; y++)
+                        {
+                            for (int x = 0; x < maze.width; x++)
+                            {
+                                if (GetMazeCell(maze, x, y) == MAZE_CELL_ITEM)
+                                {
+                                    SetMazeCell(&maze, x, y, MAZE_CELL_FLOOR);
+                                    AddMazeItem(&items, (Point){ x, y });
+                                }
+                                else if (GetMazeCell(maze, x, y) == MAZE_CELL_END) endCell = (Point){ x, y };
+                            }
+                        }
 
-                        UnloadTexture(texMaze);
-                        texMaze = LoadTextureFromImage(imMaze);
+                        mazeReloaded = true;
                     }
+                    else UnloadMaze(imported);
                 }
-                // Set Wall Position
-                else
-                {
-                    Vector2 mousePos = GetMousePosition();
 
-                    if ((mousePos.x >= position.x) && (mousePos.y >= position.y))
-                    {
-                        Point mapCoord = {
-                            (int)((mousePos.x - position.x) / MAZE_SCALE),
-                            (int)((mousePos.y - position.y) / MAZE_SCALE),
-                        };
+                UnloadDroppedFiles(droppedFiles);
+            }
 
-                        ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, WHITE);
+            // Editor camera zoom, towards mouse position
+            float wheel = GetMouseWheelMove();
 
-                        UnloadTexture(texMaze);
-                        texMaze = LoadTextureFromImage(imMaze);
-                    }
+            if (wheel != 0.0f)
+            {
+                editorCamera.target = GetScreenToWorld2D(GetMousePosition(), editorCamera);
+                editorCamera.offset = GetMousePosition();
+                editorCamera.zoom = Clamp(editorCamera.zoom*(1.0f + wheel*0.1f), 0.2f, 8.0f);
+            }
+
+            // Editor camera panning
+            if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE))
+            {
+                Vector2 mouseDelta = GetMouseDelta();
+                editorCamera.target.x -= mouseDelta.x/editorCamera.zoom;
+                editorCamera.target.y -= mouseDelta.y/editorCamera.zoom;
+            }
+
+            // TODO: [2p] Maze editor mode, edit image pixels with mouse.
+            
+            // Implement logic to select image cell from mouse position -> TIP: GetMousePosition()
+            // NOTE: Mouse position is returned in screen coordinates and it has to 
+            // transformed into image coordinates
+            // Once the cell is selected, if mouse button pressed add/remove image pixels
+
+            // WARNING: Remember that when maze changes, view must be also updated!
+            // Mouse selected cell, transformed from screen coordinates into maze coordinates
+            selectedCell = GetMazeViewCell(view, GetScreenToWorld2D(GetMousePosition(), editorCamera));
+
+            // Maze cells modified this frame, view is updated only once at the end of the frame
+            Rectangle dirtyRec = { 0 };
+
+            // Set Walkable Position (left button) or Wall Position (right button)
+            // NOTE: Strokes are interpolated from previous frame selected cell, so fast
+            // mouse movements draw continuous lines instead of isolated cells
+            int brushButton = -1;
+            if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) brushButton = MOUSE_BUTTON_LEFT;
+            else if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT) && !IsKeyDown(KEY_LEFT_CONTROL)) brushButton = MOUSE_BUTTON_RIGHT;
+
+            if (brushButton != -1)
+            {
+                Point strokeStart = (brushButton == strokeButton)? strokeCell : selectedCell;
+
+                BeginMazeJournalEdit(&journal, maze, AddDirtyRegion((Rectangle){ 0 }, strokeStart, selectedCell));
+                DrawMazeLine(&maze, strokeStart.x, strokeStart.y, selectedCell.x, selectedCell.y,
+                    (brushButton == MOUSE_BUTTON_LEFT)? MAZE_CELL_FLOOR : MAZE_CELL_WALL);
+                EndMazeJournalEdit(&journal, maze);
+                dirtyRec = AddDirtyRegion(dirtyRec, strokeStart, selectedCell);
+
+                strokeCell = selectedCell;
+            }
+
+            strokeButton = brushButton;
+
+            // Set End-Point Position
+            bool endBrush = IsMouseButtonDown(MOUSE_BUTTON_RIGHT) && IsKeyDown(KEY_LEFT_CONTROL);
+
+            if (endBrush)
+            {
+                BeginMazeJournalEdit(&journal, maze, AddDirtyRegion((Rectangle){ 0 }, selectedCell, selectedCell));
+                SetMazeCell(&maze, selectedCell.x, selectedCell.y, MAZE_CELL_END);
+                EndMazeJournalEdit(&journal, maze);
+                dirtyRec = AddDirtyRegion(dirtyRec, selectedCell, selectedCell);
+
+                // End-point moved, goal distance field and swarm goals computed again from new end-point
+                if ((selectedCell.x >= 0) && (selectedCell.y >= 0) && (selectedCell.x < maze.width) && (selectedCell.y < maze.height) &&
+                    ((selectedCell.x != endCell.x) || (selectedCell.y != endCell.y)))
+                {
+                    endCell = selectedCell;
+                    sim.endCell = endCell;
+
+                    UnloadMazeDistanceField(goalField);
+                    goalField = LoadMazeDistanceField(maze, endCell);
+                    swarmGoalsDirty = true;
                 }
             }
 
             // TODO: [2p] Collectible map items: player score
             // Using same mechanism than maze editor, implement an items editor, registering
             // points in the map where items should be added for player pickup -> TIP: Use mazeItems[]
-            //if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE))
-            if (IsKeyPressed(KEY_ENTER))
+            // Add item at selected cell, or remove it if cell already has an item
+            if (IsKeyPressed(KEY_ENTER) && (selectedCell.x >= 0) && (selectedCell.y >= 0) &&
+                (selectedCell.x < maze.width) && (selectedCell.y < maze.height))
             {
-                Vector2 mousePos = GetMousePosition();
-
-                if ((mousePos.x >= position.x) && (mousePos.y >= position.y))
-                { 
-                    Point mapCoord = {
-                        (int)((mousePos.x - position.x) / MAZE_SCALE),
-                        (int)((mousePos.y - position.y) / MAZE_SCALE),
-                    };
-
-                    for (int i = 0; i < MAX_MAZE_ITEMS; i++) {
-                        if (mazeItems[i].x == 0 && mazeItems[i].y) {
-                            mazeItems[i] = mapCoord;
-                            mazeItemPicked[i] = false;
-                            ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, RED);
-
-                            UnloadTexture(texMaze);
-                            texMaze = LoadTextureFromImage(imMaze);
-                            break;
-                        }
-                    }
+                if (!RemoveMazeItem(&items, selectedCell)) AddMazeItem(&items, selectedCell);
+                AddMazeJournalItem(&journal, selectedCell);
+            }
+
+            // Journal step closed once mouse buttons are released, a full stroke is undone at once
+            if ((brushButton == -1) && !endBrush)
+            {
+                CloseMazeJournalStep(&journal);
+
+                // Undo/redo edits and journal snapshot, restored undoing/redoing the edits in between
+                Rectangle journalRec = { 0 };
+
+                if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z)) journalRec = UndoMazeJournalStep(&journal, &maze, &items);
+                else if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y)) journalRec = RedoMazeJournalStep(&journal, &maze, &items);
+                else if (IsKeyPressed(KEY_F6)) snapshot = TakeMazeJournalSnapshot(&journal);
+                else if (IsKeyPressed(KEY_F7)) journalRec = RestoreMazeJournalSnapshot(&journal, &maze, &items, snapshot);
+
+                if ((journalRec.width > 0) && (journalRec.height > 0))
+                {
+                    dirtyRec = AddDirtyRegion(dirtyRec, (Point){ (int)journalRec.x, (int)journalRec.y },
+                        (Point){ (int)(journalRec.x + journalRec.width) - 1, (int)(journalRec.y + journalRec.height) - 1 });
                 }
             }
+
+            // Update modified cells region in view, model and distance field, avoiding a full maze reload
+            // NOTE: Only model chunks touching modified cells are regenerated
+            if ((dirtyRec.width > 0) && (dirtyRec.height > 0))
+            {
+                UpdateMazeViewCells(&view, maze, dirtyRec);
+                UpdateMazeModelCells(&model, maze, dirtyRec);
+                UpdateMazeDistanceField(&goalField, maze, dirtyRec);
+            }
+
+            EndProfilerPhase(&profiler, PHASE_EDIT);
+            MoveViewUploadTime(&profiler, &view, PHASE_EDIT);
+            BeginProfilerPhase(&profiler, PHASE_UPDATE);
+        }
+
+        // Maze replaced, reload maze view, model and distance field, player back to start-point
+        if (mazeReloaded)
+        {
+            if (!journalReplayed) ClearMazeJournal(&journal);
+
+            ResetMazeItems(&items);
+            sim = InitMazeSim(startCell, endCell);
+            simAccumulator = 0.0f;
+            swarmGoalsDirty = true;
+
+            position = (Vector2){ screenWidth / 2 - maze.width * MAZE_SCALE / 2, screenHeight / 2 - maze.height * MAZE_SCALE / 2 };
+            UnloadMazeView(&view);
+            view = LoadMazeView(maze, position, MAZE_SCALE);
+
+            UnloadMazeModel(&model);
+            model = LoadMazeModel(maze, MODEL_WALL_HEIGHT);
+
+            UnloadMazeDistanceField(goalField);
+            goalField = LoadMazeDistanceField(maze, endCell);
         }
 
         // TODO: [1p] Multiple maze biomes supported
         // Implement changing between the different textures to be used as biomes
-        // NOTE: For the 3d model, the current selected texture must be applied to the model material  
+        // NOTE: Current biome texture is used as atlas by 2d tiles and 3d model materials
         if (IsKeyPressed(KEY_ONE)) currentBiome = 0;
         if (IsKeyPressed(KEY_TWO)) currentBiome = 1;
 
+        // Player drawing position, interpolated between last two simulation ticks
+        Vector2 playerCellPosition = GetMazeSimPlayerPosition(sim, simAccumulator/MAZE_SIM_TICK_TIME);
+        playerPosition = (Vector2){ position.x + playerCellPosition.x*MAZE_SCALE, position.y + playerCellPosition.y*MAZE_SCALE };
+
+        // TODO: [1p] Camera 2D system following player movement around the map
+        // Update Camera2D parameters as required to follow player and zoom control
+        // Update camera target position with new player position
+        if (currentMode == 0)
+        {
+            camera.target = (Vector2){ playerPosition.x + 2, playerPosition.y + 2 };
+            // NOTE: Zoom is limited, every visible maze chunk must fit in the view chunks pool
+            camera.zoom = Clamp(camera.zoom + (float)GetMouseWheelMove()*0.05f, 0.5f, 10.0f);
+
+            float distance = MODEL_CAMERA_DISTANCE/camera.zoom;
+            camera3d.target = (Vector3){ playerCellPosition.x + 0.5f, 0.0f, playerCellPosition.y + 0.5f };
+            camera3d.position = (Vector3){ camera3d.target.x, distance*0.8f, camera3d.target.z + distance*0.6f };
+        }
+
+
+        EndProfilerPhase(&profiler, PHASE_UPDATE);
         //----------------------------------------------------------------------------------
 
         // Draw
         //----------------------------------------------------------------------------------
+        BeginProfilerPhase(&profiler, PHASE_DRAW_TILES);
+
         BeginDrawing();
 
             ClearBackground(RAYWHITE);
 
             if (currentMode == 0) // Game mode
             {
-                // Draw maze using camera2d (for automatic positioning and scale)
-                BeginMode2D(camera);
-
-                // TODO: Draw maze walls and floor using current texture biome 
-                for (int y = 0; y < imMaze.height; y++)
+                if (showModel)
                 {
-                    for (int x = 0; x < imMaze.width; x++)
+                    // Draw maze 3d model around player, using current biome texture as atlas
+                    BeginMode3D(camera3d);
+
+                    DrawMazeModel(&model, maze, camera3d.target, texBiomes[currentBiome]);
+
+                    DrawBillboardRec(camera3d, texPlayer, sourceRec, (Vector3){ camera3d.target.x, 0.5f, camera3d.target.z }, (Vector2){ 1.0f, 1.0f }, WHITE);
+
+                    // Draw not picked items around player, using current biome texture item tile
+                    Rectangle itemRec = GetMazeTileAtlasRec(MAZE_CELL_ITEM);
+                    Texture texAtlas = texBiomes[currentBiome];
+                    itemRec = (Rectangle){ itemRec.x*texAtlas.width, itemRec.y*texAtlas.height, itemRec.width*texAtlas.width, itemRec.height*texAtlas.height };
+
+                    for (int i = 0; i < items.count; i++)
                     {
-                        if (ColorIsEqual(GetImageColor(imMaze, x, y), WHITE))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome],
-                                (Rectangle) {
-                                0 * (texBiomes[currentBiome].width / 2), 0 * (texBiomes[currentBiome].height / 2), texBiomes[currentBiome].width / 2, texBiomes[currentBiome].height / 2
-                            },
-                                (Rectangle) {
-                                position.x + x * MAZE_SCALE, position.y + y * MAZE_SCALE, MAZE_SCALE, MAZE_SCALE
-                            },
-                                (Vector2) {
-                                0
-                            },
-                                0.0f, WHITE);
-                        }
-                        else if (ColorIsEqual(GetImageColor(imMaze, x, y), BLACK))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome],
-                                (Rectangle) {
-                                1 * (texBiomes[currentBiome].width / 2), 0 * (texBiomes[currentBiome].height / 2), texBiomes[currentBiome].width / 2, texBiomes[currentBiome].height / 2
-                            },
-                                (Rectangle) {
-                                position.x + x * MAZE_SCALE, position.y + y * MAZE_SCALE, MAZE_SCALE, MAZE_SCALE
-                            },
-                                (Vector2) {
-                                0
-                            },
-                                0.0f, WHITE);
-                        }
-                        else if (ColorIsEqual(GetImageColor(imMaze, x, y), RED))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome],
-                                (Rectangle) {
-                                0 * (texBiomes[currentBiome].width / 2), 1 * (texBiomes[currentBiome].height / 2), texBiomes[currentBiome].width / 2, texBiomes[currentBiome].height / 2
-                            },
-                                (Rectangle) {
-                                position.x + x * MAZE_SCALE, position.y + y * MAZE_SCALE, MAZE_SCALE, MAZE_SCALE
-                            },
-                                (Vector2) {
-                                0
-                            },
-                                0.0f, WHITE);
-                        }
-                        else if (ColorIsEqual(GetImageColor(imMaze, x, y), GREEN))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome],
-                                (Rectangle) {
-                                1 * (texBiomes[currentBiome].width / 2), 1 * (texBiomes[currentBiome].height / 2), texBiomes[currentBiome].width / 2, texBiomes[currentBiome].height / 2
-                            },
-                                (Rectangle) {
-                                position.x + x * MAZE_SCALE, position.y + y * MAZE_SCALE, MAZE_SCALE, MAZE_SCALE
-                            },
-                                (Vector2) {
-                                0
-                            },
-                                0.0f, WHITE);
-                        }
+                        Point cell = items.cells[i];
+
+                        if (items.picked[i] || (abs(cell.x - sim.playerCell.x) > MAZE_MODEL_DRAW_CHUNKS*MAZE_CHUNK_SIZE) ||
+                            (abs(cell.y - sim.playerCell.y) > MAZE_MODEL_DRAW_CHUNKS*MAZE_CHUNK_SIZE)) continue;
+
+                        DrawBillboardRec(camera3d, texAtlas, itemRec, (Vector3){ cell.x + 0.5f, 0.4f, cell.y + 0.5f }, (Vector2){ 0.8f, 0.8f }, WHITE);
                     }
+
+                    EndMode3D();
                 }
+                else
+                {
+                    // Draw maze using camera2d (for automatic positioning and scale)
+                    BeginMode2D(camera);
 
-                // TODO: Draw player rectangle or sprite at player position
+                    // TODO: Draw maze walls and floor using current texture biome 
+                    // Draw visible maze tiles using current biome texture as atlas
+                    DrawMazeViewTiles(&view, maze, camera, texBiomes[currentBiome]);
+
+                    // TODO: Draw player rectangle or sprite at player position
                 
-                //DrawTextureEx(texPlayer, (Vector2) { player.x, player.y }, 0.0f, 1.0f, WHITE);
+                    //DrawTextureEx(texPlayer, (Vector2) { player.x, player.y }, 0.0f, 1.0f, WHITE);
+
+                    DrawTexturePro(texPlayer, sourceRec,
+                        (Rectangle) { playerPosition.x, playerPosition.y, MAZE_SCALE, MAZE_SCALE },
+                        (Vector2) { 0 }, 0.0f, WHITE);
 
-                DrawTexturePro(texPlayer, sourceRec,
-                    (Rectangle) { player.x, player.y, MAZE_SCALE, MAZE_SCALE },
-                    (Vector2) { 0 }, 0.0f, WHITE);
+                    // Draw hint arrows, next path steps towards end-point
+                    if (showHint)
+                    {
+                        Point cell = sim.playerCell;
+
+                        for (int i = 0; i < MAZE_HINT_STEPS; i++)
+                        {
+                            Point next = GetMazeDistanceStep(goalField, cell);
+
+                            if ((next.x == cell.x) && (next.y == cell.y)) break;
+
+                            DrawHintArrow((Vector2){ position.x + (cell.x + 0.5f)*MAZE_SCALE, position.y + (cell.y + 0.5f)*MAZE_SCALE },
+                                (Vector2){ position.x + (next.x + 0.5f)*MAZE_SCALE, position.y + (next.y + 0.5f)*MAZE_SCALE },
+                                MAZE_SCALE*0.4f, Fade(YELLOW, 1.0f - (float)i/MAZE_HINT_STEPS));
+
+                            cell = next;
+                        }
+                    }
                 
-                // TODO: Draw maze items 2d (using sprite texture?)
-                        
-                for (int i = 0; i < MAX_MAZE_ITEMS; i++) {
-                    Point Item = mazeItems[i];
-                    ImageDrawPixel(&imMaze, Item.x, Item.y, RED);
+                    // TODO: Draw maze items 2d (using sprite texture?)
+                    // Draw visible not picked items, using current biome texture item tile
+                    Rectangle visibleCells = GetMazeViewVisibleCells(view, camera, GetScreenWidth(), GetScreenHeight());
+                    Rectangle itemRec = GetMazeTileAtlasRec(MAZE_CELL_ITEM);
+                    Texture texAtlas = texBiomes[currentBiome];
+                    itemRec = (Rectangle){ itemRec.x*texAtlas.width, itemRec.y*texAtlas.height, itemRec.width*texAtlas.width, itemRec.height*texAtlas.height };
+
+                    for (int i = 0; i < items.count; i++)
+                    {
+                        Point cell = items.cells[i];
+
+                        if (items.picked[i] || (cell.x < visibleCells.x) || (cell.y < visibleCells.y) ||
+                            (cell.x >= (visibleCells.x + visibleCells.width)) || (cell.y >= (visibleCells.y + visibleCells.height))) continue;
+
+                        DrawTexturePro(texAtlas, itemRec,
+                            (Rectangle){ position.x + cell.x*MAZE_SCALE, position.y + cell.y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE },
+                            (Vector2){ 0 }, 0.0f, WHITE);
+                    }
+
+                    // Draw bots swarm, all bots in a single batch
+                    if (swarmMode) DrawMazeSwarm(&swarmBatch, swarm, position, MAZE_SCALE, jobPool);
+
+                    EndMode2D();
                 }
-                    
-                EndMode2D();
+
+                EndProfilerPhase(&profiler, PHASE_DRAW_TILES);
+                BeginProfilerPhase(&profiler, PHASE_DRAW_UI);
 
                 // TODO: Draw game UI (score, time...) using custom sprites/fonts
                 // NOTE: Game UI does not receive the camera2d transformations,
                 // it is drawn in screen space coordinates directly
 
-                DrawText(TextFormat("SCORE: %i", playerScore), 10, 76, 10, RED);
+                DrawText(TextFormat("SCORE: %i/%i", sim.score, items.count), 10, 76, 10, RED);
+                DrawText(TextFormat("TIME: %.2f", (float)sim.tick/MAZE_SIM_TICK_RATE), 10, 56, 10, RED);
+                DrawText(TextFormat("[H] HINT: %s", showHint? "ON" : "OFF"), 10, 96, 10, YELLOW);
+                DrawText("[F3] RECORD REPLAY - [F4] PLAY REPLAY", 10, 116, 10, LIGHTGRAY);
+
+                if (replayState == 1) DrawText(TextFormat("RECORDING: %u TICKS", replay.header.tickCount), 10, 136, 10, RED);
+                else if (replayState == 2) DrawText(TextFormat("REPLAY: %u/%u TICKS", replay.playTick, replay.header.tickCount), 10, 136, 10, SKYBLUE);
+                else if (replayResult == 1) DrawText("REPLAY FINISHED: STATE EQUAL", 10, 136, 10, GREEN);
+                else if (replayResult == -1) DrawText("REPLAY FINISHED: STATE MISMATCH", 10, 136, 10, RED);
+
+                DrawText(TextFormat("[B] BOT SWARM: %s", swarmMode? "ON" : "OFF"), 10, 156, 10, ORANGE);
+                DrawText(TextFormat("[E] ENDLESS MAZE: %s", endlessMode? "ON" : "OFF"), 10, 196, 10, SKYBLUE);
+                if (endlessMode) DrawText(TextFormat("DEPTH: %u ROWS", stream.rowCount - maze.height + sim.playerCell.y), 10, 216, 10, SKYBLUE);
+                DrawText(TextFormat("[TAB] 3D VIEW: %s", showModel? "ON" : "OFF"), 10, 236, 10, LIME);
+                if (showModel) DrawText(TextFormat("MODEL: %i TRIANGLES - %i CHUNKS BUILT", model.triangleCount, model.rebuildCount), 10, 256, 10, LIME);
+                if (swarmMode) DrawText(TextFormat("SWARM: %i BOTS - %.2f M AGENTS/S - %u ARRIVALS", swarm.count,
+                    GetMazeSwarmThroughput(swarm)/1000000.0, swarm.arrivals), 10, 176, 10, ORANGE);
                 DrawText("[SPACE] TOGGLE MODE: EDITOR/GAME", 10, GetScreenHeight() - 20, 10, WHITE);
+
+                if (sim.finished)
+                {
+                    DrawText("MAZE COMPLETED!", GetScreenWidth()/2 - MeasureText("MAZE COMPLETED!", 40)/2, GetScreenHeight()/2 - 40, 40, YELLOW);
+                    DrawText("[ENTER] RESTART", GetScreenWidth()/2 - MeasureText("[ENTER] RESTART", 20)/2, GetScreenHeight()/2 + 10, 20, YELLOW);
+                }
                 
                 DrawFPS(10, 10);
 
             }
             else if (currentMode == 1) // Editor mode
             {
-                // Draw generated maze texture, scaled and centered on screen 
-                DrawTextureEx(texMaze, mazePosition, 0.0f, MAZE_SCALE, WHITE);
+                BeginMode2D(editorCamera);
+
+                // Draw visible maze chunks textures, scaled and centered on screen
+                DrawMazeViewCells(&view, maze, editorCamera);
+
+                // Draw lines rectangle over maze, scaled and centered on screen
+                DrawRectangleLines(position.x, position.y, maze.width*MAZE_SCALE, maze.height*MAZE_SCALE, RED);
 
-                // Draw lines rectangle over texture, scaled and centered on screen 
-                DrawRectangleLines(mazePosition.x, mazePosition.y, MAZE_WIDTH*MAZE_SCALE, MAZE_HEIGHT*MAZE_SCALE, RED);
+                // Draw items, not stored in maze cells
+                for (int i = 0; i < items.count; i++)
+                {
+                    DrawRectangle(position.x + items.cells[i].x*MAZE_SCALE, position.y + items.cells[i].y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE, RED);
+                }
 
                 // TODO: Draw player using a rectangle, consider maze screen coordinates!
-                DrawRectangle(player.x, player.y, player.width * MAZE_SCALE, player.height * MAZE_SCALE, RED);
+                DrawRectangle(playerPosition.x, playerPosition.y, MAZE_SCALE, MAZE_SCALE, RED);
+
+                EndMode2D();
+
+                EndProfilerPhase(&profiler, PHASE_DRAW_TILES);
+                BeginProfilerPhase(&profiler, PHASE_DRAW_UI);
 
                 // TODO: Draw editor UI required elements
-                DrawText("[R] GENERATE NEW RANDOM SEQUENCE", 10, 36, 10, LIGHTGRAY);
+                DrawText("[R] GENERATE NEW RANDOM SEQUENCE, EDITS REPLAYED", 10, 36, 10, LIGHTGRAY);
                 DrawText(TextFormat("SEED: %i", seed), 10, 56, 10, YELLOW);
+                DrawText(TextFormat("[PAGE UP/DOWN] MAZE SIZE: %ix%i", maze.width, maze.height), 10, 76, 10, LIGHTGRAY);
+                DrawText("[MOUSE WHEEL] ZOOM - [MIDDLE BUTTON] PAN", 10, 96, 10, LIGHTGRAY);
+                DrawText("[F5] SAVE LEVEL - [F9] LOAD LEVEL - DROP PNG TO IMPORT", 10, 136, 10, LIGHTGRAY);
+                DrawText(TextFormat("[ENTER] ADD/REMOVE ITEM: %i ITEMS", items.count), 10, 156, 10, LIGHTGRAY);
+                DrawText(TextFormat("[CTRL+Z/Y] UNDO/REDO: %i/%i STEPS - %i KB", journal.cursor, journal.stepCount,
+                    (int)((journal.runCount*sizeof(MazeJournalRun) + journal.itemCount*sizeof(Point))/1024)), 10, 176, 10, LIGHTGRAY);
+                DrawText(TextFormat("[F6] SNAPSHOT - [F7] RESTORE SNAPSHOT: STEP %i", snapshot.step), 10, 196, 10, LIGHTGRAY);
+
+                // Maze solvability, start-point reachable from end-point
+                if (GetMazeDistance(goalField, startCell.x, startCell.y) >= 0) DrawText(TextFormat("SOLVABLE: %i STEPS", GetMazeDistance(goalField, startCell.x, startCell.y)), 10, 116, 10, GREEN);
+                else DrawText("NOT SOLVABLE", 10, 116, 10, RED);
                 DrawText("[SPACE] TOGGLE MODE: EDITOR/GAME", 10, GetScreenHeight() - 20, 10, WHITE);
             }
 
             DrawFPS(10, 10);
+            DrawText("[F1] PROFILER - [F2] SAVE PROFILER DATA", 10, GetScreenHeight() - 36, 10, WHITE);
+
+            if (showProfiler) DrawFrameProfiler(&profiler, GetScreenWidth() - 346, 10);
+
+            // Replay playback frame time, update and drawing (frame wait not included)
+            if (replayState == 2)
+            {
+                replayFrameTime += GetTime() - frameStartTime;
+                replayFrameCount++;
+            }
+
+            EndProfilerPhase(&profiler, PHASE_DRAW_UI);
+            MoveViewUploadTime(&profiler, &view, PHASE_DRAW_TILES);
+            MoveModelUploadTime(&profiler, &model, PHASE_DRAW_TILES);
+
+            BeginProfilerPhase(&profiler, PHASE_END_DRAWING);
 
         EndDrawing();
+
+        EndProfilerPhase(&profiler, PHASE_END_DRAWING);
+        EndProfilerFrame(&profiler);
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
-    UnloadTexture(texMaze);     // Unload maze texture from VRAM (GPU)
-    UnloadImage(imMaze);        // Unload maze image from RAM (CPU)
-    UnloadSound(sfx);
-    UnloadSound(song);
+    UnloadMaze(maze);           // Unload maze cells from RAM (CPU)
+    UnloadMazeView(&view);      // Unload maze view chunks from RAM and VRAM (GPU)
+    UnloadMazeModel(&model);    // Unload maze model chunks from RAM and VRAM (GPU)
+    UnloadMazeJournal(&journal); // Unload editor journal from RAM (CPU)
+    UnloadMazeDistanceField(goalField); // Unload maze distance field from RAM (CPU)
+    UnloadMazeItems(items);     // Unload maze items from RAM (CPU)
+    UnloadMazeReplay(replay);   // Unload replay from RAM (CPU), if recording or playing
+    UnloadMazeSwarm(&swarm);    // Unload swarm bots from RAM (CPU), if swarm mode enabled
+    UnloadMazeSwarmBatch(&swarmBatch); // Unload swarm batch from RAM and VRAM (GPU)
+    UnloadMazeStream(&stream);  // Unload maze stream generator from RAM (CPU), if endless mode enabled
+    UnloadJobPool(jobPool);     // Unload job pool, stopping worker threads
+    UnloadFrameProfiler(&profiler); // Unload frame profiler records from RAM (CPU)
+    UnloadAssets(assets, GAME_ASSET_COUNT); // Unload assets textures and sounds from VRAM (GPU) and RAM (CPU)
+    UnloadMusicStream(music);   // Unload music stream buffers from RAM (CPU)
 
     // TODO: Unload all loaded resources
     
@@ -432,97 +1027,74 @@ int main(void)
     return 0;
 }
 
-// Generate procedural maze image, using grid-based algorithm
-// NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable, RED = Item
-Image GenImageMaze(int width, int height, int spacingRows, int spacingCols, float pointChance)
+// Add cells rectangle defined by two corner cells to region, an empty region has zero size
+static Rectangle AddDirtyRegion(Rectangle region, Point start, Point end)
 {
-    //Image imMaze = { 0 };
-    
-    // TODO: [1p] Implement maze image generation algorithm
-    Image imMaze = GenImageColor(width, height, BLACK);
+    Rectangle rec = {
+        (float)((start.x < end.x)? start.x : end.x),
+        (float)((start.y < end.y)? start.y : end.y),
+        (float)(abs(end.x - start.x) + 1),
+        (float)(abs(end.y - start.y) + 1)
+    };
 
-    // TODO: Generate procedural maze image, using grid-based algorithm
-    // NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable
-    // TODO 1.2: Draw image border
-    for (int y = 0; y < imMaze.height; y++)
+    if ((region.width > 0) && (region.height > 0))
     {
-        for (int x = 0; x < imMaze.width; x++)
-        {
-            if ((x == 0) || (x == (imMaze.width - 1)) ||
-                (y == 0) || (y == (imMaze.height - 1)))
-            {
-                ImageDrawPixel(&imMaze, x, y, WHITE);
-            }
-        }
-    }
+        float right = fmaxf(region.x + region.width, rec.x + rec.width);
+        float bottom = fmaxf(region.y + region.height, rec.y + rec.height);
 
-    // STEP 2: Set some random point in image at specific row-column distances
-
-    // TODO 2.1: Define an array of point used for maze generation
-    // NOTE A: Static array allocation, memory allocated in STACK (MAX: 1MB)
-    // NOTE B: Dynamic array allocation, memory allocated in HEAP (MAX: Available RAM)
-   
-	//Point mazePoints[64] = { 0 }; //Static array 
-	Point* mazePoints = malloc(256 * sizeof(Point)); //Dynamic array
-    int mazePointCounter = 0;
- 
-    // TODO 2.2: Store specific points, at specific row-column distances
-    for (int y = 0; y < imMaze.height; y++)
-    {
-        for (int x = 0; x < imMaze.width; x++)
-        {
-            if ((x == 0) || (x == (imMaze.width - 1)) ||
-                (y == 0) || (y == (imMaze.height - 1)))
-            {
-                ImageDrawPixel(&imMaze, x, y, WHITE);
-            }
-            else
-            {
-                if ((x % 4 == 0) && (y % 4 == 0))
-                {
-                    if (GetRandomValue(0, 100) <= 80) {
-                        mazePoints[mazePointCounter] = (Point){ x, y };
-                        mazePointCounter++;
-                    }
-                }
-            }
-        }
+        rec.x = fminf(region.x, rec.x);
+        rec.y = fminf(region.y, rec.y);
+        rec.width = right - rec.x;
+        rec.height = bottom - rec.y;
     }
 
-    // TODO 2.3: Draw our points in image
-    for (int i = 0; i < mazePointCounter; i++) {
-        ImageDrawPixel(&imMaze, mazePoints[i].x, mazePoints[i].y, WHITE);
-    }
+    return rec;
+}
 
-    // STEP 3: Draw lines from every point in a random direction
+// Draw hint arrow from one point to another
+static void DrawHintArrow(Vector2 start, Vector2 end, float size, Color color)
+{
+    Vector2 direction = Vector2Normalize(Vector2Subtract(end, start));
+    Vector2 normal = { -direction.y, direction.x };
+    Vector2 base = Vector2Subtract(end, Vector2Scale(direction, size));
 
-    // TODO 3.1: Define an array of 4 directions for convenience
-    Point directions[4] = {
-        { 0, -1 }, // North
-        { 1, 0 },  // East
-        { 0, 1 },  // South
-        { -1, 0 }  // West
-    };
+    DrawLineEx(start, base, size*0.3f, color);
 
-    // TODO 3.2: Load a random sequence of points, to be used as indices, so,
-    // we can access maze-points randomly indexed, instead of following the order we stored them
-    int* pointOrder = LoadRandomSequence(mazePointCounter, 0, mazePointCounter - 1);
+    // NOTE: Triangle vertex must be provided in counter-clockwise order
+    DrawTriangle(end, Vector2Add(base, Vector2Scale(normal, -size*0.5f)), Vector2Add(base, Vector2Scale(normal, size*0.5f)), color);
+}
 
-    // TODO 3.3: Process every random maze point, drawing pixels in one random direction,
-    // until we collision with another wall (WHITE pixel)
-    for (int i = 0; i < mazePointCounter; i++)
-    {
-        Point currentPoint = mazePoints[pointOrder[i]];
-        Point currentDir = directions[GetRandomValue(0, 3)];
-        Point nextPoint = { currentPoint.x + currentDir.x, currentPoint.y + currentDir.y };
+// Get player input buttons from keyboard (MazeInputButton flags)
+static unsigned int GetPlayerInput(void)
+{
+    unsigned int input = 0;
 
-        while (ColorIsEqual(GetImageColor(imMaze, nextPoint.x, nextPoint.y), BLACK))
-        {
-            ImageDrawPixel(&imMaze, nextPoint.x, nextPoint.y, WHITE);
-            nextPoint.x += currentDir.x;
-            nextPoint.y += currentDir.y;
-        }
-    }
-    
-    return imMaze;
+    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) input |= MAZE_INPUT_RIGHT;
+    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) input |= MAZE_INPUT_LEFT;
+    if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) input |= MAZE_INPUT_DOWN;
+    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) input |= MAZE_INPUT_UP;
+
+    return input;
+}
+
+// Move maze view GPU upload time from a profiler phase to upload phase
+// NOTE: Chunks are uploaded on demand inside editing and drawing phases, upload time is measured by the view
+static void MoveViewUploadTime(FrameProfiler *profiler, MazeView *view, int phase)
+{
+    AddProfilerPhaseTime(profiler, phase, -view->uploadTime);
+    AddProfilerPhaseTime(profiler, PHASE_UPLOAD, view->uploadTime);
+
+    view->uploadTime = 0.0;
+    view->uploadCount = 0;
+}
+
+// Move maze model chunks generation and GPU upload time from a profiler phase to upload phase
+// NOTE: Chunks meshes are generated and uploaded on demand inside drawing phase, time is measured by the model
+static void MoveModelUploadTime(FrameProfiler *profiler, MazeModel *model, int phase)
+{
+    AddProfilerPhaseTime(profiler, phase, -model->uploadTime);
+    AddProfilerPhaseTime(profiler, PHASE_UPLOAD, model->uploadTime);
+
+    model->uploadTime = 0.0;
+    model->uploadCount = 0;
 }
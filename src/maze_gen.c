@@ -0,0 +1,134 @@
+/*******************************************************************************************
+*
+*   raylib maze game - batch maze generation tool
+*
+*   Generates a range of mazes from consecutive seeds and exports them to disk,
+*   no window or audio device is initialized, so it can be used in content pipelines
+*
+*   Mazes are generated by tiles in parallel, using all CPU cores by default, generated
+*   mazes do not depend on threads count
+*
+*   Every maze is checked for solvability, from start cell (2, 2) to end cell
+*   (width - 2, height - 2), as used by the game
+*
+*   Usage: maze_gen [options]
+*       -n <count>          Number of mazes to generate (default: 1)
+*       -s <seed>           First seed of the range (default: 92683)
+*       -w <width>          Maze width in cells (default: 64)
+*       -h <height>         Maze height in cells (default: 64)
+*       -r <spacingRows>    Grid points spacing between rows (default: 4)
+*       -c <spacingCols>    Grid points spacing between columns (default: 4)
+*       -p <pointChance>    Chance of a grid point to generate a wall [0.0f..1.0f] (default: 0.75f)
+*       -o <directory>      Output directory, it must exist (default: .)
+*       -t <threads>        Generation threads, 0 for all CPU cores (default: 0)
+*       -u                  Skip unsolvable mazes, they are not exported
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "maze.h"       // Required for: GenMazeTiled(), LoadImageFromMaze()
+#include "maze_path.h"  // Required for: IsMazeSolvable()
+#include "job_pool.h"   // Required for: LoadJobPool(), UnloadJobPool()
+
+#include <stdio.h>      // Required for: printf()
+#include <stdlib.h>     // Required for: atoi(), atof(), strtoul()
+#include <string.h>     // Required for: strcmp()
+#include <time.h>       // Required for: clock()
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int count = 1;
+    unsigned int seed = 92683;
+    int width = 64;
+    int height = 64;
+    int spacingRows = 4;
+    int spacingCols = 4;
+    float pointChance = 0.75f;
+    const char *outputDir = ".";
+    int threadCount = 0;
+    bool skipUnsolvable = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-u") == 0)
+        {
+            skipUnsolvable = true;
+            continue;
+        }
+
+        if ((argv[i][0] != '-') || (i == (argc - 1)))
+        {
+            printf("Usage: maze_gen [-n count] [-s seed] [-w width] [-h height] [-r spacingRows] [-c spacingCols] [-p pointChance] [-o directory] [-t threads] [-u]\n");
+            return 1;
+        }
+
+        if (strcmp(argv[i], "-n") == 0) count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-w") == 0) width = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-h") == 0) height = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-r") == 0) spacingRows = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0) spacingCols = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-p") == 0) pointChance = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "-o") == 0) outputDir = argv[++i];
+        else if (strcmp(argv[i], "-t") == 0) threadCount = atoi(argv[++i]);
+        else
+        {
+            printf("Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if ((count < 1) || (width < 3) || (height < 3))
+    {
+        printf("Invalid parameters: count must be >= 1 and maze size >= 3x3\n");
+        return 1;
+    }
+
+    // Avoid per-file INFO messages from image export
+    SetTraceLogLevel(LOG_WARNING);
+
+    JobPool *pool = LoadJobPool(threadCount);
+    int exportedCount = 0;
+    int unsolvableCount = 0;
+    clock_t startTime = clock();
+
+    for (int i = 0; i < count; i++)
+    {
+        Maze maze = GenMazeTiled(width, height, spacingRows, spacingCols, pointChance, seed + i, pool);
+
+        if (!IsMazeSolvable(maze, (Point){ 2, 2 }, (Point){ width - 2, height - 2 }))
+        {
+            unsolvableCount++;
+
+            if (skipUnsolvable)
+            {
+                UnloadMaze(maze);
+                continue;
+            }
+        }
+
+        Image imMaze = LoadImageFromMaze(maze);
+
+        if (ExportImage(imMaze, TextFormat("%s/maze_%010u.png", outputDir, seed + i))) exportedCount++;
+        else printf("Failed to export maze for seed %u\n", seed + i);
+
+        UnloadImage(imMaze);
+        UnloadMaze(maze);
+    }
+
+    // NOTE: Process CPU time is measured, added for all generation threads
+    double elapsedTime = (double)(clock() - startTime)/CLOCKS_PER_SEC;
+
+    UnloadJobPool(pool);
+
+    printf("Generated %i/%i mazes (%ix%i) in %.3f seconds, %i unsolvable%s\n", exportedCount, count, width, height, elapsedTime,
+        unsolvableCount, skipUnsolvable? " (skipped)" : "");
+
+    return (exportedCount == (skipUnsolvable? (count - unsolvableCount) : count))? 0 : 1;
+}
@@ -0,0 +1,308 @@
+/*******************************************************************************************
+*
+*   raylib maze game - headless game simulation tool
+*
+*   Runs the game simulation without window, audio or rendering, as fast as possible,
+*   for soak tests and bot play: every episode generates a new maze (consecutive seeds),
+*   places random items and plays it with a bot until finished or ticks limit
+*
+*   Simulation invariants are checked every tick (player on walkable cell, one cell per
+*   step at most, score matching picked items) and reported as errors
+*
+*   Replay mode plays a recorded game session (maze_game, F3) instead of a bot, the maze
+*   is generated from replay seed and final player cell, score and ticks are checked,
+*   replay can be repeated to measure simulation update cost on the same inputs
+*
+*   Bots:
+*       goal    Follows the shortest path to end-point, it must finish every solvable maze
+*       random  Random walk, changing direction randomly, useful for long soak tests
+*
+*   Usage: maze_headless [options]
+*       -n <episodes>       Number of episodes to simulate (default: 100)
+*       -s <seed>           First maze seed (default: 92683)
+*       -w <width>          Maze width in cells (default: 64)
+*       -h <height>         Maze height in cells (default: 64)
+*       -i <items>          Random items per maze (default: 16)
+*       -b <bot>            Bot playing: goal, random (default: goal)
+*       -m <maxTicks>       Maximum ticks per episode (default: 1000000)
+*       -t <threads>        Generation threads, 0 for all CPU cores (default: 0)
+*       -r <replayFile>     Play replay file instead of bot episodes, -n sets replay repetitions
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "maze.h"       // Required for: GenMazeTiled(), GetMazeRandomValue(), IsMazeCellWalkable()
+#include "maze_path.h"  // Required for: LoadMazeDistanceField(), GetMazeDistanceStep()
+#include "maze_items.h" // Required for: LoadMazeItems(), AddMazeItem()
+#include "maze_sim.h"   // Required for: InitMazeSim(), UpdateMazeSim()
+#include "maze_replay.h" // Required for: LoadMazeReplay(), PlayMazeReplayInput(), IsMazeReplayStateEqual()
+#include "job_pool.h"   // Required for: LoadJobPool(), GetJobPoolTime()
+
+#include <stdio.h>      // Required for: printf()
+#include <stdlib.h>     // Required for: atoi(), strtoul(), abs()
+#include <string.h>     // Required for: strcmp()
+
+#define MAZE_POINT_CHANCE   0.75f   // Maze generation grid points chance, same as game
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Bot playing the simulation
+typedef enum {
+    BOT_GOAL = 0,       // Shortest path to end-point
+    BOT_RANDOM          // Random walk
+} BotType;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GetBotInput(BotType bot, MazeSim sim, MazeDistanceField field, MazeRandom *random, unsigned int previousInput); // Get bot input buttons for next tick
+static int RunMazeReplay(const char *fileName, int repetitions, JobPool *pool); // Run replay file repetitions, returns process exit code
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int episodes = 100;
+    unsigned int seed = 92683;
+    int width = 64;
+    int height = 64;
+    int itemCount = 16;
+    BotType bot = BOT_GOAL;
+    int maxTicks = 1000000;
+    int threadCount = 0;
+    const char *replayFile = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((argv[i][0] != '-') || (i == (argc - 1)))
+        {
+            printf("Usage: maze_headless [-n episodes] [-s seed] [-w width] [-h height] [-i items] [-b goal|random] [-m maxTicks] [-t threads] [-r replayFile]\n");
+            return 1;
+        }
+
+        if (strcmp(argv[i], "-n") == 0) episodes = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-w") == 0) width = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-h") == 0) height = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-i") == 0) itemCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-b") == 0)
+        {
+            i++;
+            if (strcmp(argv[i], "goal") == 0) bot = BOT_GOAL;
+            else if (strcmp(argv[i], "random") == 0) bot = BOT_RANDOM;
+            else
+            {
+                printf("Unknown bot: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "-m") == 0) maxTicks = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-t") == 0) threadCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-r") == 0) replayFile = argv[++i];
+        else
+        {
+            printf("Unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if ((episodes < 1) || (width < 8) || (height < 8) || (width > MAZE_MAX_SIZE) || (height > MAZE_MAX_SIZE) || (itemCount < 0) || (maxTicks < 1))
+    {
+        printf("Invalid parameters: episodes and max ticks must be >= 1, items >= 0 and maze size in range [8..%i]\n", MAZE_MAX_SIZE);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    JobPool *pool = LoadJobPool(threadCount);
+
+    if (replayFile != NULL)
+    {
+        int result = RunMazeReplay(replayFile, episodes, pool);
+        UnloadJobPool(pool);
+        return result;
+    }
+
+    MazeItems items = LoadMazeItems(itemCount);
+
+    int finishedCount = 0;
+    int unsolvableCount = 0;
+    int errorCount = 0;
+    long long totalTicks = 0;
+    long long totalScore = 0;
+    double simTime = 0.0;
+
+    for (int e = 0; e < episodes; e++)
+    {
+        Point startCell = { 2, 2 };
+        Point endCell = { width - 2, height - 2 };
+
+        Maze maze = GenMazeTiled(width, height, 4, 4, MAZE_POINT_CHANCE, seed + e, pool);
+        MazeDistanceField field = LoadMazeDistanceField(maze, endCell);
+        bool solvable = (GetMazeDistance(field, startCell.x, startCell.y) >= 0);
+
+        if (!solvable) unsolvableCount++;
+
+        // Random items on floor cells, bot random generator seeded by maze seed
+        MazeRandom random = { 0 };
+        SetMazeRandomSeed(&random, seed + e);
+
+        ClearMazeItems(&items);
+
+        for (int i = 0; i < itemCount; i++)
+        {
+            Point cell = { GetMazeRandomValue(&random, 1, width - 2), GetMazeRandomValue(&random, 1, height - 2) };
+            if (GetMazeCell(maze, cell.x, cell.y) == MAZE_CELL_FLOOR) AddMazeItem(&items, cell);
+        }
+
+        // Simulate episode, invariants checked every tick
+        MazeSim sim = InitMazeSim(startCell, endCell);
+        unsigned int input = 0;
+        int episodeErrors = 0;
+        double startTime = GetJobPoolTime();
+
+        for (int t = 0; (t < maxTicks) && !sim.finished; t++)
+        {
+            input = GetBotInput(bot, sim, field, &random, input);
+            UpdateMazeSim(&sim, maze, &items, input);
+
+            if (!IsMazeCellWalkable(maze, sim.playerCell.x, sim.playerCell.y) ||
+                ((abs(sim.playerCell.x - sim.previousCell.x) + abs(sim.playerCell.y - sim.previousCell.y)) > 1) ||
+                (sim.score != items.pickedCount)) episodeErrors++;
+        }
+
+        simTime += GetJobPoolTime() - startTime;
+
+        // Goal bot must finish solvable mazes, following the shortest path
+        if ((bot == BOT_GOAL) && solvable && (!sim.finished ||
+            (sim.tick > (unsigned int)(GetMazeDistance(field, startCell.x, startCell.y)*MAZE_SIM_MOVE_TICKS + 1)))) episodeErrors++;
+
+        if (episodeErrors > 0) printf("WARNING: Episode for seed %u: %i simulation errors\n", seed + e, episodeErrors);
+
+        if (sim.finished) finishedCount++;
+        errorCount += episodeErrors;
+        totalTicks += sim.tick;
+        totalScore += sim.score;
+
+        UnloadMazeDistanceField(field);
+        UnloadMaze(maze);
+    }
+
+    UnloadMazeItems(items);
+    UnloadJobPool(pool);
+
+    printf("Simulated %i episodes (%ix%i, %i items, %s bot): %i finished, %i unsolvable, %.1f average score, %i errors\n",
+        episodes, width, height, itemCount, (bot == BOT_GOAL)? "goal" : "random", finishedCount, unsolvableCount,
+        (double)totalScore/episodes, errorCount);
+
+    if (simTime > 0.0)
+    {
+        printf("Simulated %lli ticks in %.3f seconds: %.0f ticks/s, %.0fx real time\n", totalTicks, simTime,
+            totalTicks/simTime, totalTicks/(simTime*MAZE_SIM_TICK_RATE));
+    }
+
+    return (errorCount == 0)? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get bot input buttons for next tick
+static unsigned int GetBotInput(BotType bot, MazeSim sim, MazeDistanceField field, MazeRandom *random, unsigned int previousInput)
+{
+    unsigned int input = 0;
+
+    if (bot == BOT_GOAL)
+    {
+        Point next = GetMazeDistanceStep(field, sim.playerCell);
+
+        if (next.x > sim.playerCell.x) input = MAZE_INPUT_RIGHT;
+        else if (next.x < sim.playerCell.x) input = MAZE_INPUT_LEFT;
+        else if (next.y > sim.playerCell.y) input = MAZE_INPUT_DOWN;
+        else if (next.y < sim.playerCell.y) input = MAZE_INPUT_UP;
+    }
+    else
+    {
+        // Keep direction while moving, change it randomly or when blocked
+        bool blocked = (sim.playerCell.x == sim.previousCell.x) && (sim.playerCell.y == sim.previousCell.y) && (sim.moveTicks == 0);
+
+        if ((previousInput == 0) || blocked || (GetMazeRandomValue(random, 0, 7) == 0)) input = 1 << GetMazeRandomValue(random, 0, 3);
+        else input = previousInput;
+    }
+
+    return input;
+}
+
+// Run replay file repetitions, returns process exit code
+// NOTE: Maze is generated again from replay seed, it must be equal to recorded maze
+static int RunMazeReplay(const char *fileName, int repetitions, JobPool *pool)
+{
+    MazeReplay replay = LoadMazeReplay(fileName);
+
+    if (!IsMazeReplayValid(replay))
+    {
+        printf("Failed to load replay file: %s\n", fileName);
+        return 1;
+    }
+
+    Maze maze = GenMazeTiled(replay.header.width, replay.header.height, 4, 4, MAZE_POINT_CHANCE, replay.header.seed, pool);
+
+    if (GetMazeHash(maze) != replay.header.mazeHash)
+    {
+        printf("Replay maze can not be generated from seed %u (maze edited or generator changed)\n", replay.header.seed);
+        UnloadMaze(maze);
+        UnloadMazeReplay(replay);
+        return 1;
+    }
+
+    MazeItems items = LoadMazeItems(replay.header.itemCount);
+    for (unsigned int i = 0; i < replay.header.itemCount; i++) AddMazeItem(&items, replay.items[i]);
+
+    Point startCell = { replay.header.startX, replay.header.startY };
+    Point endCell = { replay.header.endX, replay.header.endY };
+    int mismatchCount = 0;
+    double bestTime = 0.0;
+    double totalTime = 0.0;
+    MazeSim sim = { 0 };
+
+    for (int r = 0; r < repetitions; r++)
+    {
+        sim = InitMazeSim(startCell, endCell);
+        ResetMazeItems(&items);
+        RewindMazeReplay(&replay);
+
+        double startTime = GetJobPoolTime();
+
+        while (!IsMazeReplayFinished(replay)) UpdateMazeSim(&sim, maze, &items, PlayMazeReplayInput(&replay));
+
+        double time = GetJobPoolTime() - startTime;
+
+        totalTime += time;
+        if ((r == 0) || (time < bestTime)) bestTime = time;
+
+        if (!IsMazeReplayStateEqual(replay, sim)) mismatchCount++;
+    }
+
+    printf("Replayed %s %i times (%ix%i, seed %u, %u ticks, %u input runs, %u items)\n", fileName, repetitions,
+        replay.header.width, replay.header.height, replay.header.seed, replay.header.tickCount, replay.header.runCount, replay.header.itemCount);
+    printf("Final state: cell (%i, %i), score %i, %u ticks - expected: cell (%i, %i), score %i, %u ticks: %s\n",
+        sim.playerCell.x, sim.playerCell.y, sim.score, sim.tick, replay.header.finalX, replay.header.finalY, replay.header.finalScore,
+        replay.header.tickCount, (mismatchCount == 0)? "OK" : "MISMATCH");
+
+    if (replay.header.tickCount > 0)
+    {
+        printf("Update time: %.4f us/tick average, %.4f us/tick best\n", totalTime*1000000.0/((double)replay.header.tickCount*repetitions),
+            bestTime*1000000.0/replay.header.tickCount);
+    }
+
+    UnloadMazeItems(items);
+    UnloadMaze(maze);
+    UnloadMazeReplay(replay);
+
+    return (mismatchCount == 0)? 0 : 1;
+}
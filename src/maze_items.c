@@ -0,0 +1,213 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze items module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_items.h"
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GetCellHash(Point cell);                // Get cell hash, cell must be valid
+static int FindItemSlot(MazeItems items, Point cell);       // Find cell slot in index: item slot or first empty slot
+static bool ResizeItemsIndex(MazeItems *items, int size);   // Resize cells hash index, re-indexing all items
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze items store, capacity grows as required
+MazeItems LoadMazeItems(int capacity)
+{
+    MazeItems items = { 0 };
+
+    if (capacity < 16) capacity = 16;
+
+    items.cells = (Point *)malloc(capacity*sizeof(Point));
+    items.picked = (bool *)malloc(capacity*sizeof(bool));
+
+    if ((items.cells == NULL) || (items.picked == NULL) || !ResizeItemsIndex(&items, 32))
+    {
+        UnloadMazeItems(items);
+        return (MazeItems){ 0 };
+    }
+
+    items.capacity = capacity;
+
+    return items;
+}
+
+// Unload maze items store from memory
+void UnloadMazeItems(MazeItems items)
+{
+    free(items.cells);
+    free(items.picked);
+    free(items.index);
+}
+
+// Remove all items
+void ClearMazeItems(MazeItems *items)
+{
+    for (int i = 0; i < items->indexSize; i++) items->index[i] = 0;
+
+    items->count = 0;
+    items->pickedCount = 0;
+}
+
+// Set all items as not picked
+void ResetMazeItems(MazeItems *items)
+{
+    for (int i = 0; i < items->count; i++) items->picked[i] = false;
+
+    items->pickedCount = 0;
+}
+
+// Add item at cell, returns item index (-1 if cell is not valid or already has an item)
+int AddMazeItem(MazeItems *items, Point cell)
+{
+    if ((items->index == NULL) || (cell.x < 0) || (cell.y < 0) || (cell.x >= MAZE_MAX_SIZE) || (cell.y >= MAZE_MAX_SIZE)) return -1;
+
+    // Keep index load factor under 50%, short probe sequences
+    if (((items->count + 1)*2 > items->indexSize) && !ResizeItemsIndex(items, items->indexSize*2)) return -1;
+
+    int slot = FindItemSlot(*items, cell);
+
+    if (items->index[slot] != 0) return -1;
+
+    if (items->count >= items->capacity)
+    {
+        int capacity = items->capacity*2;
+        Point *cells = (Point *)realloc(items->cells, capacity*sizeof(Point));
+        if (cells != NULL) items->cells = cells;
+        bool *picked = (bool *)realloc(items->picked, capacity*sizeof(bool));
+        if (picked != NULL) items->picked = picked;
+
+        if ((cells == NULL) || (picked == NULL)) return -1;
+
+        items->capacity = capacity;
+    }
+
+    int itemIndex = items->count++;
+    items->cells[itemIndex] = cell;
+    items->picked[itemIndex] = false;
+    items->index[slot] = itemIndex + 1;
+
+    return itemIndex;
+}
+
+// Remove item at cell, returns false if no item
+// NOTE: Last item is moved to the removed item index, index slots after the removed one
+// are shifted back to keep probe sequences unbroken (no tombstones required)
+bool RemoveMazeItem(MazeItems *items, Point cell)
+{
+    if ((items->index == NULL) || (GetMazeItem(*items, cell) < 0)) return false;
+
+    int slot = FindItemSlot(*items, cell);
+    int itemIndex = items->index[slot] - 1;
+    unsigned int mask = (unsigned int)items->indexSize - 1;
+
+    // Backward shift deletion
+    int hole = slot;
+    int next = (hole + 1) & mask;
+
+    while (items->index[next] != 0)
+    {
+        int home = GetCellHash(items->cells[items->index[next] - 1]) & mask;
+
+        // Move entry to hole if its home slot is not in (hole, next] range (cyclic)
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            items->index[hole] = items->index[next];
+            hole = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    items->index[hole] = 0;
+
+    // Move last item to removed item index
+    if (items->picked[itemIndex]) items->pickedCount--;
+
+    int lastIndex = --items->count;
+
+    if (itemIndex != lastIndex)
+    {
+        items->index[FindItemSlot(*items, items->cells[lastIndex])] = itemIndex + 1;
+        items->cells[itemIndex] = items->cells[lastIndex];
+        items->picked[itemIndex] = items->picked[lastIndex];
+    }
+
+    return true;
+}
+
+// Get item index at cell, -1 if no item
+int GetMazeItem(MazeItems items, Point cell)
+{
+    if ((items.index == NULL) || (cell.x < 0) || (cell.y < 0) || (cell.x >= MAZE_MAX_SIZE) || (cell.y >= MAZE_MAX_SIZE)) return -1;
+
+    return items.index[FindItemSlot(items, cell)] - 1;
+}
+
+// Pick item at cell, returns item index (-1 if no item or already picked)
+int PickMazeItem(MazeItems *items, Point cell)
+{
+    int itemIndex = GetMazeItem(*items, cell);
+
+    if ((itemIndex < 0) || items->picked[itemIndex]) return -1;
+
+    items->picked[itemIndex] = true;
+    items->pickedCount++;
+
+    return itemIndex;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get cell hash, cell must be valid
+static unsigned int GetCellHash(Point cell)
+{
+    unsigned int hash = ((unsigned int)cell.y*MAZE_MAX_SIZE + (unsigned int)cell.x)*2654435761u;
+
+    return hash ^ (hash >> 16);
+}
+
+// Find cell slot in index: item slot or first empty slot
+// NOTE: Index always has empty slots (load factor under 50%), so probing ends
+static int FindItemSlot(MazeItems items, Point cell)
+{
+    unsigned int mask = (unsigned int)items.indexSize - 1;
+    unsigned int slot = GetCellHash(cell) & mask;
+
+    while (items.index[slot] != 0)
+    {
+        Point itemCell = items.cells[items.index[slot] - 1];
+
+        if ((itemCell.x == cell.x) && (itemCell.y == cell.y)) break;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return (int)slot;
+}
+
+// Resize cells hash index, re-indexing all items
+static bool ResizeItemsIndex(MazeItems *items, int size)
+{
+    int *index = (int *)calloc(size, sizeof(int));
+
+    if (index == NULL) return false;
+
+    free(items->index);
+    items->index = index;
+    items->indexSize = size;
+
+    for (int i = 0; i < items->count; i++) items->index[FindItemSlot(*items, items->cells[i])] = i + 1;
+
+    return true;
+}
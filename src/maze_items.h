@@ -0,0 +1,59 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze items module
+*
+*   Items store, kept separate from maze cells: items are stored in dense arrays and
+*   indexed by cell in a hash table (open addressing, linear probing), so items can be
+*   found, added, removed and picked in constant time, for any number of items
+*
+*   NOTE: This module only uses raylib CPU-side functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ITEMS_H
+#define MAZE_ITEMS_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Point, MAZE_MAX_SIZE
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze items store
+// NOTE: Item indices change when items are removed (last item is moved to removed index)
+typedef struct MazeItems {
+    int count;                  // Items count
+    int capacity;               // Items arrays capacity
+    Point *cells;               // Items cells
+    bool *picked;               // Items picked state
+    int pickedCount;            // Picked items count
+    int *index;                 // Cells hash index, item index + 1 per slot (0 for empty slots)
+    int indexSize;              // Cells hash index slots count (power of two)
+} MazeItems;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeItems LoadMazeItems(int capacity);                      // Load maze items store, capacity grows as required
+void UnloadMazeItems(MazeItems items);                      // Unload maze items store from memory
+void ClearMazeItems(MazeItems *items);                      // Remove all items
+void ResetMazeItems(MazeItems *items);                      // Set all items as not picked
+
+int AddMazeItem(MazeItems *items, Point cell);              // Add item at cell, returns item index (-1 if cell is not valid or already has an item)
+bool RemoveMazeItem(MazeItems *items, Point cell);          // Remove item at cell, returns false if no item
+int GetMazeItem(MazeItems items, Point cell);               // Get item index at cell, -1 if no item
+int PickMazeItem(MazeItems *items, Point cell);             // Pick item at cell, returns item index (-1 if no item or already picked)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ITEMS_H
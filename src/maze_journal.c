@@ -0,0 +1,407 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze editor journal module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_journal.h"
+
+#include <stdlib.h>         // Required for: malloc(), realloc(), free()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_JOURNAL_MAX_RUN    0xffff      // Maximum cells per run, run count is 16 bit
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool ReserveJournalArray(void **data, int *capacity, int count, int size); // Reserve array capacity for one more element, capacity doubled as required
+static MazeJournalStep *OpenMazeJournalStep(MazeJournal *journal); // Open a new step if none open, steps to redo are discarded
+static bool AddMazeJournalRun(MazeJournal *journal, MazeJournalStep *step, MazeJournalRun run); // Add run to step, merged with step last run if contiguous
+static Rectangle AddBoundsRegion(Rectangle bounds, Rectangle rec); // Add rectangle to bounds region, an empty region has zero size
+static void ToggleMazeItem(MazeItems *items, Point cell);   // Remove item at cell, or add it if cell has no item
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze journal, runs capacity grows as required
+MazeJournal LoadMazeJournal(int capacity)
+{
+    MazeJournal journal = { 0 };
+
+    if (capacity < 64) capacity = 64;
+
+    journal.runs = (MazeJournalRun *)malloc(capacity*sizeof(MazeJournalRun));
+    journal.items = (Point *)malloc(16*sizeof(Point));
+    journal.steps = (MazeJournalStep *)malloc(16*sizeof(MazeJournalStep));
+
+    if ((journal.runs == NULL) || (journal.items == NULL) || (journal.steps == NULL))
+    {
+        UnloadMazeJournal(&journal);
+        return journal;
+    }
+
+    journal.runCapacity = capacity;
+    journal.itemCapacity = 16;
+    journal.stepCapacity = 16;
+    journal.nextId = 1;
+
+    return journal;
+}
+
+// Unload maze journal from memory
+void UnloadMazeJournal(MazeJournal *journal)
+{
+    free(journal->runs);
+    free(journal->items);
+    free(journal->steps);
+    free(journal->capture);
+
+    *journal = (MazeJournal){ 0 };
+}
+
+// Remove all journal steps
+// NOTE: Step ids are not reused, previous snapshots are not valid anymore
+void ClearMazeJournal(MazeJournal *journal)
+{
+    journal->runCount = 0;
+    journal->itemCount = 0;
+    journal->stepCount = 0;
+    journal->cursor = 0;
+    journal->stepOpen = false;
+    journal->captureRec = (Rectangle){ 0 };
+}
+
+// Begin maze cells edit, region cells saved before modification
+// NOTE: Region should contain every cell modified until EndMazeJournalEdit(), cells out of region are not recorded
+void BeginMazeJournalEdit(MazeJournal *journal, Maze maze, Rectangle cells)
+{
+    int startX = (cells.x < 0)? 0 : (int)cells.x;
+    int startY = (cells.y < 0)? 0 : (int)cells.y;
+    int endX = ((cells.x + cells.width) > maze.width)? maze.width : (int)(cells.x + cells.width);
+    int endY = ((cells.y + cells.height) > maze.height)? maze.height : (int)(cells.y + cells.height);
+
+    journal->captureRec = (Rectangle){ 0 };
+
+    if ((journal->steps == NULL) || (endX <= startX) || (endY <= startY)) return;
+
+    int count = (endX - startX)*(endY - startY);
+
+    if (count > journal->captureCapacity)
+    {
+        unsigned char *capture = (unsigned char *)realloc(journal->capture, count);
+
+        if (capture == NULL) return;
+
+        journal->capture = capture;
+        journal->captureCapacity = count;
+    }
+
+    unsigned char *cell = journal->capture;
+
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++) *cell++ = (unsigned char)GetMazeCell(maze, x, y);
+    }
+
+    journal->captureRec = (Rectangle){ (float)startX, (float)startY, (float)(endX - startX), (float)(endY - startY) };
+}
+
+// End maze cells edit, modified cells added to current step
+// NOTE: A step is only opened if some cell was modified, so strokes over cells with same type are not recorded
+void EndMazeJournalEdit(MazeJournal *journal, Maze maze)
+{
+    int startX = (int)journal->captureRec.x;
+    int startY = (int)journal->captureRec.y;
+    int width = (int)journal->captureRec.width;
+    int height = (int)journal->captureRec.height;
+
+    journal->captureRec = (Rectangle){ 0 };
+
+    for (int j = 0; j < height; j++)
+    {
+        const unsigned char *oldCells = journal->capture + j*width;
+        int y = startY + j;
+        int i = 0;
+
+        while (i < width)
+        {
+            int newCell = GetMazeCell(maze, startX + i, y);
+
+            if (oldCells[i] == newCell)
+            {
+                i++;
+                continue;
+            }
+
+            // Run of cells with same previous and new cell type
+            MazeJournalRun run = { (unsigned short)(startX + i), (unsigned short)y, 1, oldCells[i], (unsigned char)newCell };
+
+            for (i++; (i < width) && (oldCells[i] == run.oldCell) && (GetMazeCell(maze, startX + i, y) == run.newCell); i++) run.count++;
+
+            MazeJournalStep *step = OpenMazeJournalStep(journal);
+
+            if ((step == NULL) || !AddMazeJournalRun(journal, step, run))
+            {
+                TraceLog(LOG_WARNING, "MAZE: Failed to record maze journal edit, journal memory could not be allocated");
+                return;
+            }
+        }
+    }
+}
+
+// Add toggled item (added or removed) to current step
+void AddMazeJournalItem(MazeJournal *journal, Point cell)
+{
+    MazeJournalStep *step = OpenMazeJournalStep(journal);
+
+    if ((step == NULL) || !ReserveJournalArray((void **)&journal->items, &journal->itemCapacity, journal->itemCount, sizeof(Point)))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to record maze journal item, journal memory could not be allocated");
+        return;
+    }
+
+    journal->items[journal->itemCount++] = cell;
+    step->itemCount++;
+}
+
+// Close current step, next edits start a new step
+void CloseMazeJournalStep(MazeJournal *journal)
+{
+    journal->stepOpen = false;
+}
+
+// Undo last applied step, returns modified cells region
+// NOTE: Runs are undone backwards, a step could modify the same cells several times
+Rectangle UndoMazeJournalStep(MazeJournal *journal, Maze *maze, MazeItems *items)
+{
+    CloseMazeJournalStep(journal);
+
+    if (journal->cursor == 0) return (Rectangle){ 0 };
+
+    MazeJournalStep step = journal->steps[--journal->cursor];
+
+    for (int r = step.firstRun + step.runCount - 1; r >= step.firstRun; r--)
+    {
+        MazeJournalRun run = journal->runs[r];
+        FillMazeCells(maze, run.x, run.y, run.count, 1, run.oldCell);
+    }
+
+    for (int i = step.firstItem + step.itemCount - 1; i >= step.firstItem; i--) ToggleMazeItem(items, journal->items[i]);
+
+    return step.bounds;
+}
+
+// Redo next step, returns modified cells region
+Rectangle RedoMazeJournalStep(MazeJournal *journal, Maze *maze, MazeItems *items)
+{
+    CloseMazeJournalStep(journal);
+
+    if (journal->cursor >= journal->stepCount) return (Rectangle){ 0 };
+
+    MazeJournalStep step = journal->steps[journal->cursor++];
+
+    for (int r = step.firstRun; r < (step.firstRun + step.runCount); r++)
+    {
+        MazeJournalRun run = journal->runs[r];
+        FillMazeCells(maze, run.x, run.y, run.count, 1, run.newCell);
+    }
+
+    for (int i = step.firstItem; i < (step.firstItem + step.itemCount); i++) ToggleMazeItem(items, journal->items[i]);
+
+    return step.bounds;
+}
+
+// Take journal snapshot, current journal position (current step closed)
+// NOTE: Snapshot does not copy maze cells, it is only valid for the journal it was taken from
+MazeJournalSnapshot TakeMazeJournalSnapshot(MazeJournal *journal)
+{
+    CloseMazeJournalStep(journal);
+
+    MazeJournalSnapshot snapshot = { 0 };
+    snapshot.step = journal->cursor;
+    snapshot.id = (journal->cursor > 0)? journal->steps[journal->cursor - 1].id : 0;
+
+    return snapshot;
+}
+
+// Check snapshot position is still in journal history
+// NOTE: Snapshot is not valid if its steps were discarded by new steps after an undo
+bool IsMazeJournalSnapshotValid(MazeJournal journal, MazeJournalSnapshot snapshot)
+{
+    if ((snapshot.step < 0) || (snapshot.step > journal.stepCount)) return false;
+
+    return (snapshot.step == 0) || (journal.steps[snapshot.step - 1].id == snapshot.id);
+}
+
+// Restore journal snapshot, returns modified cells region
+// NOTE: Steps between current position and snapshot are undone or redone, cost depends on cells edited in between
+Rectangle RestoreMazeJournalSnapshot(MazeJournal *journal, Maze *maze, MazeItems *items, MazeJournalSnapshot snapshot)
+{
+    Rectangle bounds = { 0 };
+
+    CloseMazeJournalStep(journal);
+
+    if (!IsMazeJournalSnapshotValid(*journal, snapshot))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Maze journal snapshot not valid, journal steps discarded");
+        return bounds;
+    }
+
+    while (journal->cursor > snapshot.step) bounds = AddBoundsRegion(bounds, UndoMazeJournalStep(journal, maze, items));
+    while (journal->cursor < snapshot.step) bounds = AddBoundsRegion(bounds, RedoMazeJournalStep(journal, maze, items));
+
+    return bounds;
+}
+
+// Replay applied steps cells onto a new maze, steps to redo are discarded
+// NOTE: Runs are recorded again with new maze previous cells, so replayed steps can be undone,
+// cells out of new maze bounds are dropped, items are not modified (items are not maze cells)
+void ReplayMazeJournal(MazeJournal *journal, Maze *maze)
+{
+    CloseMazeJournalStep(journal);
+
+    if (journal->steps == NULL) return;
+
+    MazeJournalRun *runs = journal->runs;
+    journal->runs = (MazeJournalRun *)malloc(journal->runCapacity*sizeof(MazeJournalRun));
+
+    if (journal->runs == NULL)
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to replay maze journal, journal memory could not be allocated");
+        journal->runs = runs;
+        return;
+    }
+
+    journal->runCount = 0;
+    journal->stepCount = journal->cursor;
+    journal->itemCount = (journal->cursor > 0)? (journal->steps[journal->cursor - 1].firstItem + journal->steps[journal->cursor - 1].itemCount) : 0;
+
+    for (int s = 0; s < journal->stepCount; s++)
+    {
+        MazeJournalStep *step = &journal->steps[s];
+        int firstRun = step->firstRun;
+        int lastRun = step->firstRun + step->runCount;
+
+        step->firstRun = journal->runCount;
+        step->runCount = 0;
+        step->bounds = (Rectangle){ 0 };
+
+        for (int r = firstRun; r < lastRun; r++)
+        {
+            MazeJournalRun run = runs[r];
+
+            for (int x = run.x; (x < (run.x + run.count)) && (x < maze->width) && (run.y < maze->height); x++)
+            {
+                MazeJournalRun cell = { (unsigned short)x, run.y, 1, (unsigned char)GetMazeCell(*maze, x, run.y), run.newCell };
+
+                // NOTE: Cells already of new cell type are kept, so edits are not lost replaying again
+                AddMazeJournalRun(journal, step, cell);
+                SetMazeCell(maze, x, run.y, run.newCell);
+            }
+        }
+    }
+
+    free(runs);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Reserve array capacity for one more element, capacity doubled as required
+static bool ReserveJournalArray(void **data, int *capacity, int count, int size)
+{
+    if (count < *capacity) return true;
+
+    void *resized = realloc(*data, (size_t)(*capacity)*2*size);
+
+    if (resized == NULL) return false;
+
+    *data = resized;
+    *capacity *= 2;
+
+    return true;
+}
+
+// Open a new step if none open, steps to redo are discarded
+static MazeJournalStep *OpenMazeJournalStep(MazeJournal *journal)
+{
+    if (journal->steps == NULL) return NULL;
+    if (journal->stepOpen) return &journal->steps[journal->stepCount - 1];
+
+    // Discard steps after cursor, journal is only appended from current position
+    if (journal->cursor < journal->stepCount)
+    {
+        MazeJournalStep last = (journal->cursor > 0)? journal->steps[journal->cursor - 1] : (MazeJournalStep){ 0 };
+
+        journal->stepCount = journal->cursor;
+        journal->runCount = last.firstRun + last.runCount;
+        journal->itemCount = last.firstItem + last.itemCount;
+    }
+
+    if (!ReserveJournalArray((void **)&journal->steps, &journal->stepCapacity, journal->stepCount, sizeof(MazeJournalStep))) return NULL;
+
+    MazeJournalStep *step = &journal->steps[journal->stepCount++];
+    step->id = journal->nextId++;
+    step->firstRun = journal->runCount;
+    step->runCount = 0;
+    step->firstItem = journal->itemCount;
+    step->itemCount = 0;
+    step->bounds = (Rectangle){ 0 };
+
+    journal->cursor = journal->stepCount;
+    journal->stepOpen = true;
+
+    return step;
+}
+
+// Add run to step, merged with step last run if contiguous
+static bool AddMazeJournalRun(MazeJournal *journal, MazeJournalStep *step, MazeJournalRun run)
+{
+    step->bounds = AddBoundsRegion(step->bounds, (Rectangle){ (float)run.x, (float)run.y, (float)run.count, 1.0f });
+
+    if (step->runCount > 0)
+    {
+        MazeJournalRun *last = &journal->runs[journal->runCount - 1];
+
+        if ((last->y == run.y) && ((last->x + last->count) == run.x) && (last->oldCell == run.oldCell) &&
+            (last->newCell == run.newCell) && ((last->count + run.count) <= MAZE_JOURNAL_MAX_RUN))
+        {
+            last->count += run.count;
+            return true;
+        }
+    }
+
+    if (!ReserveJournalArray((void **)&journal->runs, &journal->runCapacity, journal->runCount, sizeof(MazeJournalRun))) return false;
+
+    journal->runs[journal->runCount++] = run;
+    step->runCount++;
+
+    return true;
+}
+
+// Add rectangle to bounds region, an empty region has zero size
+static Rectangle AddBoundsRegion(Rectangle bounds, Rectangle rec)
+{
+    if ((rec.width <= 0) || (rec.height <= 0)) return bounds;
+    if ((bounds.width <= 0) || (bounds.height <= 0)) return rec;
+
+    float right = ((bounds.x + bounds.width) > (rec.x + rec.width))? (bounds.x + bounds.width) : (rec.x + rec.width);
+    float bottom = ((bounds.y + bounds.height) > (rec.y + rec.height))? (bounds.y + bounds.height) : (rec.y + rec.height);
+
+    bounds.x = (bounds.x < rec.x)? bounds.x : rec.x;
+    bounds.y = (bounds.y < rec.y)? bounds.y : rec.y;
+    bounds.width = right - bounds.x;
+    bounds.height = bottom - bounds.y;
+
+    return bounds;
+}
+
+// Remove item at cell, or add it if cell has no item
+static void ToggleMazeItem(MazeItems *items, Point cell)
+{
+    if (!RemoveMazeItem(items, cell)) AddMazeItem(items, cell);
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze editor journal module
+*
+*   Editor undo/redo history, maze edits stored as cells deltas in an append-only journal:
+*
+*       - Runs: modified cells along a row with same previous and new cell type (8 bytes)
+*       - Steps: undo units (i.e. one mouse stroke), a range of runs and toggled items
+*
+*   Edits are recorded comparing a cells region before and after modification, so editing
+*   functions do not need to know about the journal, only modified cells are stored
+*
+*   Undo applies step runs previous cells backwards, redo applies new cells forwards, a new
+*   step after an undo discards the steps that could be redone
+*
+*   Snapshots are journal positions, not maze copies: restoring a snapshot undoes or redoes
+*   the steps in between, so memory only depends on the number of cells edited
+*
+*   Journal runs use cell coordinates, independent of maze size, so edits can be replayed
+*   onto another maze (i.e. generated with a new seed), previous cells taken from new maze
+*
+*   NOTE: This module only uses raylib CPU-side functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_JOURNAL_H
+#define MAZE_JOURNAL_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, Point
+#include "maze_items.h"     // Required for: MazeItems
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze journal run, modified cells along a row
+// NOTE: Coordinates fit in 16 bit, maze size is limited to MAZE_MAX_SIZE
+typedef struct MazeJournalRun {
+    unsigned short x;           // Run first cell x
+    unsigned short y;           // Run row
+    unsigned short count;       // Run cells count
+    unsigned char oldCell;      // Cells type before step (MazeCellType)
+    unsigned char newCell;      // Cells type after step (MazeCellType)
+} MazeJournalRun;
+
+// Maze journal step, one undo unit
+typedef struct MazeJournalStep {
+    unsigned int id;            // Step unique id in journal, used to validate snapshots
+    int firstRun;               // Step first run in journal runs
+    int runCount;               // Step runs count
+    int firstItem;              // Step first item in journal items
+    int itemCount;              // Step toggled items count
+    Rectangle bounds;           // Step modified cells bounds, empty if no cells modified
+} MazeJournalStep;
+
+// Maze journal, editor undo/redo history
+typedef struct MazeJournal {
+    MazeJournalRun *runs;       // Steps runs, appended in edits order
+    int runCount;               // Runs count
+    int runCapacity;            // Runs array capacity
+    Point *items;               // Steps toggled items cells (added or removed)
+    int itemCount;              // Toggled items count
+    int itemCapacity;           // Toggled items array capacity
+    MazeJournalStep *steps;     // Journal steps
+    int stepCount;              // Steps count
+    int stepCapacity;           // Steps array capacity
+    int cursor;                 // Applied steps count, steps after cursor can be redone
+    bool stepOpen;              // Last step open, next edits are added to it
+    unsigned int nextId;        // Next step id
+    unsigned char *capture;     // Edit region cells before modification
+    int captureCapacity;        // Capture buffer capacity
+    Rectangle captureRec;       // Edit region, clamped to maze bounds
+} MazeJournal;
+
+// Maze journal snapshot, a journal position
+typedef struct MazeJournalSnapshot {
+    int step;                   // Applied steps count
+    unsigned int id;            // Last applied step id, 0 if no step applied
+} MazeJournalSnapshot;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeJournal LoadMazeJournal(int capacity);                  // Load maze journal, runs capacity grows as required
+void UnloadMazeJournal(MazeJournal *journal);               // Unload maze journal from memory
+void ClearMazeJournal(MazeJournal *journal);                // Remove all journal steps
+
+void BeginMazeJournalEdit(MazeJournal *journal, Maze maze, Rectangle cells); // Begin maze cells edit, region cells saved before modification
+void EndMazeJournalEdit(MazeJournal *journal, Maze maze);   // End maze cells edit, modified cells added to current step
+void AddMazeJournalItem(MazeJournal *journal, Point cell);   // Add toggled item (added or removed) to current step
+void CloseMazeJournalStep(MazeJournal *journal);            // Close current step, next edits start a new step
+
+Rectangle UndoMazeJournalStep(MazeJournal *journal, Maze *maze, MazeItems *items); // Undo last applied step, returns modified cells region
+Rectangle RedoMazeJournalStep(MazeJournal *journal, Maze *maze, MazeItems *items); // Redo next step, returns modified cells region
+
+MazeJournalSnapshot TakeMazeJournalSnapshot(MazeJournal *journal); // Take journal snapshot, current journal position (current step closed)
+bool IsMazeJournalSnapshotValid(MazeJournal journal, MazeJournalSnapshot snapshot); // Check snapshot position is still in journal history
+Rectangle RestoreMazeJournalSnapshot(MazeJournal *journal, Maze *maze, MazeItems *items, MazeJournalSnapshot snapshot); // Restore journal snapshot, returns modified cells region
+
+void ReplayMazeJournal(MazeJournal *journal, Maze *maze);   // Replay applied steps cells onto a new maze, steps to redo are discarded
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_JOURNAL_H
@@ -0,0 +1,525 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze 3d model module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_model.h"
+
+#include "raymath.h"        // Required for: MatrixIdentity()
+
+#include "maze_tiles.h"     // Required for: GetMazeTileAtlasRec()
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <string.h>         // Required for: memset(), memcpy()
+#include <math.h>           // Required for: floorf(), fabsf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze model faces, quads orientation
+typedef enum {
+    MAZE_FACE_FLOOR = 0,        // Walkable cells floor, facing up at Y = 0
+    MAZE_FACE_TOP,              // Walls top, facing up at Y = wallHeight
+    MAZE_FACE_EAST,             // Walls side facing +X
+    MAZE_FACE_WEST,             // Walls side facing -X
+    MAZE_FACE_SOUTH,            // Walls side facing +Z
+    MAZE_FACE_NORTH,            // Walls side facing -Z
+    MAZE_FACE_COUNT
+} MazeFace;
+
+// Maze model merged quad, in region cells coordinates
+typedef struct MazeModelQuad {
+    unsigned char face;         // Quad face (MazeFace)
+    unsigned char tile;         // Quad atlas tile (MazeCellType)
+    unsigned short x;           // Quad first cell
+    unsigned short y;
+    unsigned short width;       // Quad size in cells, sides are one cell wide along their run
+    unsigned short height;
+} MazeModelQuad;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// Faces shading, stored as vertex colors, so walls sides can be told apart without lighting
+static const Color faceColors[MAZE_FACE_COUNT] = {
+    { 255, 255, 255, 255 }, { 255, 255, 255, 255 },
+    { 205, 205, 205, 255 }, { 205, 205, 205, 255 },
+    { 170, 170, 170, 255 }, { 170, 170, 170, 255 }
+};
+
+// Model shader, tile texcoords repeated inside atlas tile rectangle (texcoords2)
+#if (GLSL_VERSION == 330)
+static const char *modelVertexShader =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec2 vertexTexCoord2;\n"
+    "in vec4 vertexColor;\n"
+    "uniform mat4 mvp;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec2 fragTexCoord2;\n"
+    "out vec4 fragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragTexCoord2 = vertexTexCoord2;\n"
+    "    fragColor = vertexColor;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char *modelFragmentShader =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec2 fragTexCoord2;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    finalColor = texture(texture0, fragTexCoord2 + fract(fragTexCoord)*0.5)*colDiffuse*fragColor;\n"
+    "}\n";
+#else
+static const char *modelVertexShader =
+    "#version 100\n"
+    "attribute vec3 vertexPosition;\n"
+    "attribute vec2 vertexTexCoord;\n"
+    "attribute vec2 vertexTexCoord2;\n"
+    "attribute vec4 vertexColor;\n"
+    "uniform mat4 mvp;\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec2 fragTexCoord2;\n"
+    "varying vec4 fragColor;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragTexCoord2 = vertexTexCoord2;\n"
+    "    fragColor = vertexColor;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char *modelFragmentShader =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec2 fragTexCoord2;\n"
+    "varying vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = texture2D(texture0, fragTexCoord2 + fract(fragTexCoord)*0.5)*colDiffuse*fragColor;\n"
+    "}\n";
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int GenMazeModelSides(const unsigned char *grid, int width, int height, MazeModelQuad *quads, int face); // Generate walls side quads for a face, merged runs
+static int GetMazeModelSlot(MazeModel *model, int chunkIndex);      // Get pool slot for a chunk, recycling least recently used one if required
+static void UnloadMazeModelSlot(MazeModel *model, int slot);        // Unload pool slot mesh
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Generate 3d mesh for a maze cells region, greedy merged faces (max: MAZE_CHUNK_CELLS cells)
+// NOTE: Region is clipped to maze bounds, cells out of maze bounds are walls (no sides facing them),
+// quads count is bounded by 3 quads per cell, so a chunk mesh fits 16bit indices
+Mesh GenMeshMazeModel(Maze maze, Rectangle cells, float wallHeight)
+{
+    Mesh mesh = { 0 };
+
+    int startX = (cells.x < 0)? 0 : (int)cells.x;
+    int startY = (cells.y < 0)? 0 : (int)cells.y;
+    int endX = (int)(cells.x + cells.width);
+    int endY = (int)(cells.y + cells.height);
+    if (endX > maze.width) endX = maze.width;
+    if (endY > maze.height) endY = maze.height;
+
+    if ((endX <= startX) || (endY <= startY)) return mesh;
+    if ((endX - startX)*(endY - startY) > MAZE_CHUNK_CELLS)
+    {
+        TraceLog(LOG_WARNING, "MAZE: Model region too big (%ix%i), max cells: %i", endX - startX, endY - startY, MAZE_CHUNK_CELLS);
+        return mesh;
+    }
+
+    int width = endX - startX;
+    int height = endY - startY;
+
+    // Region cells with one cell border, so sides facing neighbor cells are found without bounds checks
+    // NOTE: Cells are read row by row from chunks, only border cells use GetMazeCell()
+    unsigned char *grid = (unsigned char *)malloc((width + 2)*(height + 2));
+    unsigned char *mask = (unsigned char *)malloc(width*height);
+    MazeModelQuad *quads = (MazeModelQuad *)malloc((3*width*height + 2*(width + height))*sizeof(MazeModelQuad));
+    int quadCount = 0;
+
+    for (int y = -1; y <= height; y++)
+    {
+        unsigned char *row = grid + (y + 1)*(width + 2);
+
+        row[0] = (unsigned char)GetMazeCell(maze, startX - 1, startY + y);
+        row[width + 1] = (unsigned char)GetMazeCell(maze, endX, startY + y);
+
+        if ((y < 0) || (y == height))
+        {
+            for (int x = 0; x < width; x++) row[x + 1] = (unsigned char)GetMazeCell(maze, startX + x, startY + y);
+        }
+        else
+        {
+            for (int x = 0; x < width; )
+            {
+                // Contiguous cells until chunk row end
+                int count = MAZE_CHUNK_SIZE - ((startX + x) & MAZE_CHUNK_MASK);
+                if (count > (width - x)) count = width - x;
+
+                memcpy(row + x + 1, maze.cells + GetMazeCellIndex(maze, startX + x, startY + y), count);
+                x += count;
+            }
+
+            // Horizontal faces mask, cell type + 1, 0 once merged
+            for (int x = 0; x < width; x++) mask[y*width + x] = (unsigned char)((row[x + 1] & 3) + 1);
+        }
+    }
+
+    // STEP 1: Horizontal faces, greedy rectangles of same cell type
+    // NOTE: Rectangles grow along row first, then down while the whole row segment matches
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int value = mask[y*width + x];
+
+            if (value == 0) continue;
+
+            int quadWidth = 1;
+            while (((x + quadWidth) < width) && (mask[y*width + x + quadWidth] == value)) quadWidth++;
+
+            int quadHeight = 1;
+            for (; (y + quadHeight) < height; quadHeight++)
+            {
+                const unsigned char *row = mask + (y + quadHeight)*width + x;
+                int i = 0;
+
+                while ((i < quadWidth) && (row[i] == value)) i++;
+                if (i < quadWidth) break;
+            }
+
+            for (int j = 0; j < quadHeight; j++) memset(mask + (y + j)*width + x, 0, quadWidth);
+
+            quads[quadCount++] = (MazeModelQuad){ (unsigned char)(((value - 1) == MAZE_CELL_WALL)? MAZE_FACE_TOP : MAZE_FACE_FLOOR),
+                (unsigned char)(value - 1), (unsigned short)x, (unsigned short)y, (unsigned short)quadWidth, (unsigned short)quadHeight };
+        }
+    }
+
+    // STEP 2: Walls sides, runs of walls facing walkable cells
+    for (int face = MAZE_FACE_EAST; face < MAZE_FACE_COUNT; face++) quadCount += GenMazeModelSides(grid, width, height, quads + quadCount, face);
+
+    free(grid);
+    free(mask);
+
+    // STEP 3: Quads vertex data, atlas tile origin as texcoords2 for every vertex
+    mesh.vertexCount = quadCount*4;
+    mesh.triangleCount = quadCount*2;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.texcoords2 = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.colors = (unsigned char *)RL_MALLOC(mesh.vertexCount*4*sizeof(unsigned char));
+    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+    // Atlas rectangles lookup, avoid computing them per quad
+    Rectangle atlasRecs[4] = { 0 };
+    for (int i = 0; i < 4; i++) atlasRecs[i] = GetMazeTileAtlasRec(i);
+
+    for (int i = 0; i < quadCount; i++)
+    {
+        MazeModelQuad quad = quads[i];
+        float x = (float)(startX + quad.x);
+        float z = (float)(startY + quad.y);
+        float quadWidth = (float)quad.width;
+        float quadHeight = (float)quad.height;
+
+        // Quad top-left corner and edges, as seen from the front
+        // NOTE: Vertex order top-left, bottom-left, bottom-right, top-right is counter-clockwise, required by backface culling
+        Vector3 corner = { 0 };
+        Vector3 right = { 0 };
+        Vector3 down = { 0.0f, -wallHeight, 0.0f };
+
+        switch (quad.face)
+        {
+            case MAZE_FACE_FLOOR: corner = (Vector3){ x, 0.0f, z }; right = (Vector3){ quadWidth, 0.0f, 0.0f }; down = (Vector3){ 0.0f, 0.0f, quadHeight }; break;
+            case MAZE_FACE_TOP: corner = (Vector3){ x, wallHeight, z }; right = (Vector3){ quadWidth, 0.0f, 0.0f }; down = (Vector3){ 0.0f, 0.0f, quadHeight }; break;
+            case MAZE_FACE_EAST: corner = (Vector3){ x + 1.0f, wallHeight, z + quadHeight }; right = (Vector3){ 0.0f, 0.0f, -quadHeight }; break;
+            case MAZE_FACE_WEST: corner = (Vector3){ x, wallHeight, z }; right = (Vector3){ 0.0f, 0.0f, quadHeight }; break;
+            case MAZE_FACE_SOUTH: corner = (Vector3){ x, wallHeight, z + 1.0f }; right = (Vector3){ quadWidth, 0.0f, 0.0f }; break;
+            case MAZE_FACE_NORTH: corner = (Vector3){ x + quadWidth, wallHeight, z }; right = (Vector3){ -quadWidth, 0.0f, 0.0f }; break;
+            default: break;
+        }
+
+        // Texcoords in tiles, one tile per cell and per wallHeight unit
+        float tilesU = fabsf(right.x + right.z);
+        float tilesV = fabsf(down.y + down.z);
+        Rectangle uv = atlasRecs[quad.tile & 3];
+        Color color = faceColors[quad.face];
+
+        float *vertices = mesh.vertices + i*12;
+        vertices[0] = corner.x; vertices[1] = corner.y; vertices[2] = corner.z;
+        vertices[3] = corner.x + down.x; vertices[4] = corner.y + down.y; vertices[5] = corner.z + down.z;
+        vertices[6] = corner.x + down.x + right.x; vertices[7] = corner.y + down.y + right.y; vertices[8] = corner.z + down.z + right.z;
+        vertices[9] = corner.x + right.x; vertices[10] = corner.y + right.y; vertices[11] = corner.z + right.z;
+
+        float *texcoords = mesh.texcoords + i*8;
+        texcoords[0] = 0.0f;   texcoords[1] = 0.0f;
+        texcoords[2] = 0.0f;   texcoords[3] = tilesV;
+        texcoords[4] = tilesU; texcoords[5] = tilesV;
+        texcoords[6] = tilesU; texcoords[7] = 0.0f;
+
+        float *texcoords2 = mesh.texcoords2 + i*8;
+        unsigned char *colors = mesh.colors + i*16;
+
+        for (int v = 0; v < 4; v++)
+        {
+            texcoords2[v*2] = uv.x;
+            texcoords2[v*2 + 1] = uv.y;
+            colors[v*4] = color.r;
+            colors[v*4 + 1] = color.g;
+            colors[v*4 + 2] = color.b;
+            colors[v*4 + 3] = color.a;
+        }
+
+        unsigned short *indices = mesh.indices + i*6;
+        indices[0] = (unsigned short)(i*4);
+        indices[1] = (unsigned short)(i*4 + 1);
+        indices[2] = (unsigned short)(i*4 + 2);
+        indices[3] = (unsigned short)(i*4);
+        indices[4] = (unsigned short)(i*4 + 2);
+        indices[5] = (unsigned short)(i*4 + 3);
+    }
+
+    free(quads);
+
+    return mesh;
+}
+
+// Load maze model, no chunk is loaded until drawn
+MazeModel LoadMazeModel(Maze maze, float wallHeight)
+{
+    MazeModel model = { 0 };
+
+    model.wallHeight = wallHeight;
+    model.chunksX = maze.chunksX;
+    model.chunksY = maze.chunksY;
+    model.chunkSlots = (int *)malloc(maze.chunksX*maze.chunksY*sizeof(int));
+    model.slots = (MazeModelChunk *)calloc(MAZE_MODEL_MAX_CHUNKS, sizeof(MazeModelChunk));
+    model.material = LoadMaterialDefault();
+    model.material.shader = LoadShaderFromMemory(modelVertexShader, modelFragmentShader);
+
+    for (int i = 0; i < maze.chunksX*maze.chunksY; i++) model.chunkSlots[i] = -1;
+    for (int i = 0; i < MAZE_MODEL_MAX_CHUNKS; i++) model.slots[i].index = -1;
+
+    return model;
+}
+
+// Unload maze model and all loaded chunks
+void UnloadMazeModel(MazeModel *model)
+{
+    if (model->slots != NULL)
+    {
+        for (int i = 0; i < MAZE_MODEL_MAX_CHUNKS; i++) UnloadMazeModelSlot(model, i);
+    }
+
+    free(model->chunkSlots);
+    free(model->slots);
+
+    // NOTE: Material diffuse texture is the atlas provided on drawing, not owned by the model
+    if (model->material.shader.id > 0) UnloadShader(model->material.shader);
+    RL_FREE(model->material.maps);
+
+    *model = (MazeModel){ 0 };
+}
+
+// Update loaded chunks for a modified maze cells region
+// NOTE: Region is extended one cell, neighbor chunks walls sides can face modified cells,
+// chunks meshes are regenerated when drawn
+void UpdateMazeModelCells(MazeModel *model, Maze maze, Rectangle cells)
+{
+    int startX = (cells.x < 1)? 0 : (int)cells.x - 1;
+    int startY = (cells.y < 1)? 0 : (int)cells.y - 1;
+    int endX = (int)(cells.x + cells.width) + 1;
+    int endY = (int)(cells.y + cells.height) + 1;
+    if (endX > maze.width) endX = maze.width;
+    if (endY > maze.height) endY = maze.height;
+
+    if ((endX <= startX) || (endY <= startY) || (model->chunkSlots == NULL)) return;
+
+    for (int cy = (startY >> MAZE_CHUNK_SHIFT); cy <= ((endY - 1) >> MAZE_CHUNK_SHIFT); cy++)
+    {
+        for (int cx = (startX >> MAZE_CHUNK_SHIFT); cx <= ((endX - 1) >> MAZE_CHUNK_SHIFT); cx++)
+        {
+            int slot = model->chunkSlots[cy*model->chunksX + cx];
+
+            if (slot >= 0) model->slots[slot].dirty = true;
+        }
+    }
+}
+
+// Draw maze chunks around a 3d position, inside BeginMode3D()
+// NOTE: One draw call per chunk, meshes are generated the first time a chunk is drawn,
+// generation and upload time is accumulated in model uploadTime
+void DrawMazeModel(MazeModel *model, Maze maze, Vector3 position, Texture atlas)
+{
+    if (model->chunkSlots == NULL) return;
+
+    int centerX = (int)floorf(position.x);
+    int centerY = (int)floorf(position.z);
+    if (centerX < 0) centerX = 0;
+    if (centerY < 0) centerY = 0;
+    if (centerX >= maze.width) centerX = maze.width - 1;
+    if (centerY >= maze.height) centerY = maze.height - 1;
+
+    int startX = (centerX >> MAZE_CHUNK_SHIFT) - MAZE_MODEL_DRAW_CHUNKS;
+    int startY = (centerY >> MAZE_CHUNK_SHIFT) - MAZE_MODEL_DRAW_CHUNKS;
+    int endX = (centerX >> MAZE_CHUNK_SHIFT) + MAZE_MODEL_DRAW_CHUNKS;
+    int endY = (centerY >> MAZE_CHUNK_SHIFT) + MAZE_MODEL_DRAW_CHUNKS;
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX >= model->chunksX) endX = model->chunksX - 1;
+    if (endY >= model->chunksY) endY = model->chunksY - 1;
+
+    model->frameCounter++;
+    model->triangleCount = 0;
+    model->material.maps[MATERIAL_MAP_DIFFUSE].texture = atlas;
+
+    for (int cy = startY; cy <= endY; cy++)
+    {
+        for (int cx = startX; cx <= endX; cx++)
+        {
+            int slot = GetMazeModelSlot(model, cy*model->chunksX + cx);
+
+            if (slot < 0) continue;     // Pool exhausted, too many drawn chunks
+
+            MazeModelChunk *chunk = &model->slots[slot];
+
+            if ((chunk->mesh.vertexCount == 0) || chunk->dirty)
+            {
+                double uploadStartTime = GetTime();
+
+                if (chunk->mesh.vertexCount > 0) UnloadMesh(chunk->mesh);
+
+                chunk->mesh = GenMeshMazeModel(maze, (Rectangle){ (float)(cx*MAZE_CHUNK_SIZE), (float)(cy*MAZE_CHUNK_SIZE),
+                    MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE }, model->wallHeight);
+                UploadMesh(&chunk->mesh, false);
+                chunk->dirty = false;
+
+                model->uploadTime += GetTime() - uploadStartTime;
+                model->uploadCount++;
+                model->rebuildCount++;
+            }
+
+            DrawMesh(chunk->mesh, model->material, MatrixIdentity());
+            model->triangleCount += chunk->mesh.triangleCount;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Generate walls side quads for a face, merged runs
+// NOTE: East/west sides run along columns, north/south sides run along rows, grid has one cell border
+static int GenMazeModelSides(const unsigned char *grid, int width, int height, MazeModelQuad *quads, int face)
+{
+    int quadCount = 0;
+    int stride = width + 2;
+    bool columns = (face == MAZE_FACE_EAST) || (face == MAZE_FACE_WEST);
+    int lineCount = columns? width : height;
+    int lineLength = columns? height : width;
+    int step = columns? stride : 1;             // Next cell along the run
+    int lineStep = columns? 1 : stride;         // Next run line
+    int neighbor = 0;                           // Faced cell offset
+
+    switch (face)
+    {
+        case MAZE_FACE_EAST: neighbor = 1; break;
+        case MAZE_FACE_WEST: neighbor = -1; break;
+        case MAZE_FACE_SOUTH: neighbor = stride; break;
+        case MAZE_FACE_NORTH: neighbor = -stride; break;
+        default: break;
+    }
+
+    for (int line = 0; line < lineCount; line++)
+    {
+        const unsigned char *cells = grid + stride + 1 + line*lineStep;
+        int runStart = -1;
+
+        for (int i = 0; i <= lineLength; i++)
+        {
+            const unsigned char *cell = cells + i*step;
+            bool side = (i < lineLength) && (cell[0] == MAZE_CELL_WALL) && (cell[neighbor] != MAZE_CELL_WALL);
+
+            if (side && (runStart < 0)) runStart = i;
+            else if (!side && (runStart >= 0))
+            {
+                if (columns) quads[quadCount++] = (MazeModelQuad){ (unsigned char)face, MAZE_CELL_WALL, (unsigned short)line, (unsigned short)runStart, 1, (unsigned short)(i - runStart) };
+                else quads[quadCount++] = (MazeModelQuad){ (unsigned char)face, MAZE_CELL_WALL, (unsigned short)runStart, (unsigned short)line, (unsigned short)(i - runStart), 1 };
+
+                runStart = -1;
+            }
+        }
+    }
+
+    return quadCount;
+}
+
+// Get pool slot for a chunk, recycling least recently used one if required
+// NOTE: Chunks drawn in current frame are never recycled, -1 is returned if no slot available
+static int GetMazeModelSlot(MazeModel *model, int chunkIndex)
+{
+    int slot = model->chunkSlots[chunkIndex];
+
+    if (slot < 0)
+    {
+        for (int i = 0; i < MAZE_MODEL_MAX_CHUNKS; i++)
+        {
+            if (model->slots[i].index == -1) { slot = i; break; }
+            if ((model->slots[i].lastFrame != model->frameCounter) &&
+                ((slot < 0) || (model->slots[i].lastFrame < model->slots[slot].lastFrame))) slot = i;
+        }
+
+        if (slot < 0) return -1;
+
+        UnloadMazeModelSlot(model, slot);
+
+        model->slots[slot].index = chunkIndex;
+        model->chunkSlots[chunkIndex] = slot;
+    }
+
+    model->slots[slot].lastFrame = model->frameCounter;
+
+    return slot;
+}
+
+// Unload pool slot mesh
+static void UnloadMazeModelSlot(MazeModel *model, int slot)
+{
+    MazeModelChunk *chunk = &model->slots[slot];
+
+    if (chunk->index == -1) return;
+
+    if (chunk->mesh.vertexCount > 0) UnloadMesh(chunk->mesh);
+
+    model->chunkSlots[chunk->index] = -1;
+    *chunk = (MazeModelChunk){ 0 };
+    chunk->index = -1;
+}
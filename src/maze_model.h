@@ -0,0 +1,87 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze 3d model module
+*
+*   Builds a 3d model from maze cells: walls are unit cubes of wallHeight, walkable cells
+*   are floor quads, only visible faces are generated (no wall bottoms, no faces between
+*   adjacent walls) and coplanar faces of the same tile are merged by greedy meshing:
+*
+*       - Horizontal faces (floor and walls top): rectangles of same cell type
+*       - Wall sides: runs of wall cells facing walkable cells, along rows and columns
+*
+*   Maze 3d coordinates: one world unit per cell, cell (x, y) is placed at X = x, Z = y,
+*   walls top at Y = wallHeight
+*
+*   Merged faces use the biome texture 2x2 tiles atlas (same as maze_tiles): texcoords are
+*   provided in tiles (repeated every unit) and texcoords2 is the atlas tile origin, the
+*   model shader repeats the tile inside its atlas rectangle
+*
+*   Model meshes are generated by chunks, only chunks around a 3d position are loaded
+*   and drawn, kept in a fixed-size pool and recycled least-recently-used first, modified
+*   cells regenerate only the chunks touching them
+*
+*   NOTE: Mesh generation is done on CPU only, it does not require a window initialized,
+*   so it can be used from command line tools; model functions require a window (GPU)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_MODEL_H
+#define MAZE_MODEL_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_MODEL_DRAW_CHUNKS      2       // Chunks drawn around model draw position, in every direction
+#define MAZE_MODEL_MAX_CHUNKS       32      // Maximum number of chunks meshes loaded at the same time
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze model chunk, mesh for one maze chunk
+typedef struct MazeModelChunk {
+    int index;                  // Maze chunk index (chunkY*chunksX + chunkX), -1 if unused
+    Mesh mesh;                  // Chunk mesh, vertexCount is 0 if not loaded
+    bool dirty;                 // Mesh must be regenerated before drawing
+    unsigned int lastFrame;     // Last frame the chunk was drawn
+} MazeModelChunk;
+
+// Maze model, 3d drawing state for a maze
+typedef struct MazeModel {
+    float wallHeight;           // Walls height (world units, cell size is 1.0f)
+    int chunksX;                // Maze chunks per row
+    int chunksY;                // Maze chunks per column
+    int *chunkSlots;            // Pool slot for every maze chunk, -1 if not loaded
+    MazeModelChunk *slots;      // Loaded chunks pool (MAZE_MODEL_MAX_CHUNKS)
+    unsigned int frameCounter;  // Drawn frames counter, for chunks recycling
+    Material material;          // Model material, atlas tiles shader, diffuse texture set on drawing
+    int triangleCount;          // Triangles drawn last frame
+    int rebuildCount;           // Chunks meshes generated, reset by user
+    double uploadTime;          // Chunks meshes generation and GPU upload time accumulated (seconds), reset by user
+    int uploadCount;            // Chunks GPU uploads accumulated, reset by user
+} MazeModel;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+Mesh GenMeshMazeModel(Maze maze, Rectangle cells, float wallHeight); // Generate 3d mesh for a maze cells region, greedy merged faces (max: MAZE_CHUNK_CELLS cells)
+
+MazeModel LoadMazeModel(Maze maze, float wallHeight);       // Load maze model, no chunk is loaded until drawn
+void UnloadMazeModel(MazeModel *model);                     // Unload maze model and all loaded chunks
+void UpdateMazeModelCells(MazeModel *model, Maze maze, Rectangle cells); // Update loaded chunks for a modified maze cells region
+void DrawMazeModel(MazeModel *model, Maze maze, Vector3 position, Texture atlas); // Draw maze chunks around a 3d position, inside BeginMode3D()
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_MODEL_H
@@ -0,0 +1,59 @@
+/*******************************************************************************************
+*
+*   raylib maze game - resource pack tool
+*
+*   Packs resource files into a single resource pack (.rpak), loaded by the game at
+*   startup with one sequential read, packed entries are named by file name (no path)
+*
+*   Packed files are listed after export, reading the pack back to check it is valid
+*
+*   Usage: maze_pack <packFile> <file> [file ...]
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "resource_pack.h"  // Required for: ExportResourcePack(), LoadResourcePack()
+
+#include <stdio.h>          // Required for: printf()
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        printf("Usage: maze_pack <packFile> <file> [file ...]\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    if (!ExportResourcePack((const char **)(argv + 2), argc - 2, argv[1]))
+    {
+        printf("Failed to export resource pack: %s\n", argv[1]);
+        return 1;
+    }
+
+    ResourcePack pack = LoadResourcePack(argv[1]);
+
+    if (!IsResourcePackValid(pack))
+    {
+        printf("Exported resource pack is not valid: %s\n", argv[1]);
+        return 1;
+    }
+
+    for (unsigned int i = 0; i < pack.header->entryCount; i++)
+    {
+        printf("%-52s %10u bytes (offset %u)\n", pack.entries[i].name, pack.entries[i].size, pack.entries[i].offset);
+    }
+
+    printf("%s: %u files, %i bytes\n", argv[1], pack.header->entryCount, pack.dataSize);
+
+    UnloadResourcePack(pack);
+
+    return 0;
+}
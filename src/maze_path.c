@@ -0,0 +1,745 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze pathfinding module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_path.h"
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free(), abs(), qsort()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Growable array of ints, internal to the module
+typedef struct IntArray {
+    int *data;
+    int count;
+    int capacity;
+} IntArray;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void PushIntArray(IntArray *array, int value);       // Add value to array, growing it if required
+static int CompareDistanceSeeds(const void *a, const void *b); // Compare (distance, index) seed pairs, for qsort()
+
+static void ResetDistanceField(MazeDistanceField *field, Maze maze); // Reset field distances from maze cells, no goal propagation
+static void PropagateDistances(MazeDistanceField *field, const int *seeds, int seedCount); // Propagate distances from sorted seed cells
+
+static bool ReserveOpenList(MazePathFinder *finder, int capacity); // Reserve path finder open list capacity (pairs)
+static void PushOpenList(MazePathFinder *finder, int *count, int key, int cell); // Push (key, cell) pair into open list binary heap
+static int PopOpenList(MazePathFinder *finder, int *count, int *key); // Pop lowest key cell from open list binary heap
+
+static bool JumpHorizontal(Maze maze, int x, int y, int dx, Point end, int *jumpX); // Jump horizontally from cell, checking forced neighbors
+static bool JumpVertical(Maze maze, int x, int y, int dy, Point end, int *jumpY); // Jump vertically from cell, scanning horizontally on every step
+static int SearchMazePath(MazePathFinder *finder, Maze maze, Point start, Point end, int method); // Search path, parents are set for path cells
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Distance field
+//----------------------------------------------------------------------------------
+// Load maze distance field to goal cell (BFS)
+// NOTE: If goal is not walkable, all walkable cells are unreachable
+MazeDistanceField LoadMazeDistanceField(Maze maze, Point goal)
+{
+    MazeDistanceField field = { 0 };
+
+    if ((maze.cells == NULL) || (maze.width <= 0) || (maze.height <= 0)) return field;
+
+    field.width = maze.width;
+    field.height = maze.height;
+    field.goal = goal;
+    field.distances = (int *)malloc((size_t)(maze.width + 2)*(maze.height + 2)*sizeof(int));
+    field.queue = (int *)malloc((size_t)maze.width*maze.height*sizeof(int));
+
+    if ((field.distances == NULL) || (field.queue == NULL))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to allocate distance field (%ix%i)", maze.width, maze.height);
+        UnloadMazeDistanceField(field);
+        return (MazeDistanceField){ 0 };
+    }
+
+    ResetDistanceField(&field, maze);
+
+    return field;
+}
+
+// Load maze distance field to nearest of several goal cells (multi-source BFS)
+// NOTE: Field goal is set to first goal, UpdateMazeDistanceField() only keeps first goal if
+// a goal cell is modified, so the field must be loaded again when maze cells are modified
+MazeDistanceField LoadMazeDistanceFieldGoals(Maze maze, const Point *goals, int goalCount)
+{
+    // No walkable goal cell, all walkable cells are unreachable
+    MazeDistanceField field = LoadMazeDistanceField(maze, (Point){ -1, -1 });
+
+    if ((field.distances == NULL) || (goalCount <= 0)) return field;
+
+    field.goal = goals[0];
+
+    int stride = field.width + 2;
+    int *seeds = (int *)malloc(goalCount*sizeof(int));
+    int seedCount = 0;
+
+    if (seeds == NULL) return field;
+
+    // All goals seeded at distance 0, already sorted by distance
+    for (int i = 0; i < goalCount; i++)
+    {
+        if (!IsMazeCellWalkable(maze, goals[i].x, goals[i].y)) continue;
+
+        int index = (goals[i].y + 1)*stride + (goals[i].x + 1);
+
+        if (field.distances[index] == 0) continue;
+
+        field.distances[index] = 0;
+        seeds[seedCount++] = index;
+    }
+
+    PropagateDistances(&field, seeds, seedCount);
+
+    free(seeds);
+
+    return field;
+}
+
+// Unload maze distance field from memory
+void UnloadMazeDistanceField(MazeDistanceField field)
+{
+    free(field.distances);
+    free(field.queue);
+}
+
+// Update distance field for a modified maze cells region
+// NOTE: Only cells whose walkability changed are considered: added walls invalidate the cells
+// that reached the goal through them, then invalidated and new floor cells are re-seeded from
+// their valid neighbors, so update cost depends on the affected cells, not on maze size
+void UpdateMazeDistanceField(MazeDistanceField *field, Maze maze, Rectangle cells)
+{
+    if ((field->distances == NULL) || (maze.width != field->width) || (maze.height != field->height)) return;
+
+    int startX = (cells.x < 0)? 0 : (int)cells.x;
+    int startY = (cells.y < 0)? 0 : (int)cells.y;
+    int endX = (int)(cells.x + cells.width);
+    int endY = (int)(cells.y + cells.height);
+    if (endX > maze.width) endX = maze.width;
+    if (endY > maze.height) endY = maze.height;
+
+    if ((endX <= startX) || (endY <= startY)) return;
+
+    // Goal cell modified, full field computation required
+    if ((field->goal.x >= startX) && (field->goal.x < endX) && (field->goal.y >= startY) && (field->goal.y < endY))
+    {
+        ResetDistanceField(field, maze);
+        return;
+    }
+
+    int *distances = field->distances;
+    int stride = field->width + 2;
+    int offsets[4] = { -1, 1, -stride, stride };
+
+    IntArray checks = { 0 };        // Cells to check for a valid parent (distance - 1 neighbor)
+    IntArray floors = { 0 };        // Cells changed from wall to walkable
+    int invalidCount = 0;           // Invalidated cells, stored in field queue
+
+    // STEP 1: Find cells with modified walkability
+    for (int y = startY; y < endY; y++)
+    {
+        for (int x = startX; x < endX; x++)
+        {
+            int index = (y + 1)*stride + (x + 1);
+            int distance = distances[index];
+            bool walkable = IsMazeCellWalkable(maze, x, y);
+
+            if (!walkable && (distance != MAZE_DISTANCE_WALL))
+            {
+                distances[index] = MAZE_DISTANCE_WALL;
+
+                // Cells reaching goal through the new wall must be checked
+                if (distance >= 0)
+                {
+                    for (int i = 0; i < 4; i++)
+                    {
+                        if (distances[index + offsets[i]] == (distance + 1)) PushIntArray(&checks, index + offsets[i]);
+                    }
+                }
+            }
+            else if (walkable && (distance == MAZE_DISTANCE_WALL))
+            {
+                distances[index] = MAZE_DISTANCE_UNREACHABLE;
+                PushIntArray(&floors, index);
+            }
+        }
+    }
+
+    // STEP 2: Invalidate cells without a valid parent, checking their children recursively
+    // NOTE: A kept cell is checked again if its parent is invalidated later
+    while (checks.count > 0)
+    {
+        int index = checks.data[--checks.count];
+        int distance = distances[index];
+
+        if (distance <= 0) continue;
+
+        bool valid = false;
+        for (int i = 0; i < 4; i++)
+        {
+            if (distances[index + offsets[i]] == (distance - 1)) { valid = true; break; }
+        }
+
+        if (!valid)
+        {
+            distances[index] = MAZE_DISTANCE_UNREACHABLE;
+            field->queue[invalidCount++] = index;
+
+            for (int i = 0; i < 4; i++)
+            {
+                if (distances[index + offsets[i]] == (distance + 1)) PushIntArray(&checks, index + offsets[i]);
+            }
+        }
+    }
+
+    // STEP 3: Seed propagation from valid cells around invalidated and new floor cells
+    // NOTE: Seeds are stored as (distance, index) pairs, sorted by distance
+    IntArray seeds = { 0 };
+
+    for (int n = 0; n < (invalidCount + floors.count); n++)
+    {
+        int index = (n < invalidCount)? field->queue[n] : floors.data[n - invalidCount];
+
+        for (int i = 0; i < 4; i++)
+        {
+            int distance = distances[index + offsets[i]];
+
+            if (distance >= 0)
+            {
+                PushIntArray(&seeds, distance);
+                PushIntArray(&seeds, index + offsets[i]);
+            }
+        }
+    }
+
+    int seedCount = seeds.count/2;
+
+    if (seedCount > 0)
+    {
+        qsort(seeds.data, seedCount, 2*sizeof(int), CompareDistanceSeeds);
+        for (int i = 0; i < seedCount; i++) seeds.data[i] = seeds.data[i*2 + 1];
+
+        // STEP 4: Propagate distances, decreasing distances of cells reached by a shorter path
+        PropagateDistances(field, seeds.data, seedCount);
+    }
+
+    free(checks.data);
+    free(floors.data);
+    free(seeds.data);
+}
+
+// Get cell distance to goal (or MAZE_DISTANCE_UNREACHABLE/MAZE_DISTANCE_WALL)
+int GetMazeDistance(MazeDistanceField field, int x, int y)
+{
+    if ((field.distances == NULL) || (x < 0) || (y < 0) || (x >= field.width) || (y >= field.height)) return MAZE_DISTANCE_WALL;
+
+    return field.distances[(y + 1)*(field.width + 2) + (x + 1)];
+}
+
+// Get next cell towards goal, same cell if goal or unreachable
+Point GetMazeDistanceStep(MazeDistanceField field, Point cell)
+{
+    int distance = GetMazeDistance(field, cell.x, cell.y);
+
+    if (distance <= 0) return cell;
+
+    Point neighbors[4] = { { cell.x + 1, cell.y }, { cell.x - 1, cell.y }, { cell.x, cell.y + 1 }, { cell.x, cell.y - 1 } };
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (GetMazeDistance(field, neighbors[i].x, neighbors[i].y) == (distance - 1)) return neighbors[i];
+    }
+
+    return cell;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Path queries
+//----------------------------------------------------------------------------------
+// Load maze path finder, search memory for maze size
+MazePathFinder LoadMazePathFinder(Maze maze)
+{
+    MazePathFinder finder = { 0 };
+
+    if ((maze.cells == NULL) || (maze.width <= 0) || (maze.height <= 0)) return finder;
+
+    size_t cellCount = (size_t)maze.width*maze.height;
+
+    finder.width = maze.width;
+    finder.height = maze.height;
+    finder.stamps = (unsigned int *)calloc(cellCount, sizeof(unsigned int));
+    finder.costs = (int *)malloc(cellCount*sizeof(int));
+    finder.parents = (int *)malloc(cellCount*sizeof(int));
+
+    if ((finder.stamps == NULL) || (finder.costs == NULL) || (finder.parents == NULL))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to allocate path finder (%ix%i)", maze.width, maze.height);
+        UnloadMazePathFinder(finder);
+        return (MazePathFinder){ 0 };
+    }
+
+    return finder;
+}
+
+// Unload maze path finder from memory
+void UnloadMazePathFinder(MazePathFinder finder)
+{
+    free(finder.stamps);
+    free(finder.costs);
+    free(finder.parents);
+    free(finder.open);
+}
+
+// Load path from start to end cell, length is -1 if no path
+// NOTE: JPS search only stores jump points as parents, straight segments between them are filled
+MazePath LoadMazePath(MazePathFinder *finder, Maze maze, Point start, Point end, int method)
+{
+    MazePath path = { -1, NULL };
+
+    int length = SearchMazePath(finder, maze, start, end, method);
+
+    if (length < 0) return path;
+
+    path.points = (Point *)malloc((length + 1)*sizeof(Point));
+
+    if (path.points == NULL) return path;
+
+    path.length = length;
+
+    // Fill path backwards, from end to start
+    Point cell = end;
+    int n = length;
+
+    while (n > 0)
+    {
+        int parent = finder->parents[cell.y*finder->width + cell.x];
+        Point parentCell = { parent%finder->width, parent/finder->width };
+        int dx = (parentCell.x > cell.x) - (parentCell.x < cell.x);
+        int dy = (parentCell.y > cell.y) - (parentCell.y < cell.y);
+
+        while ((cell.x != parentCell.x) || (cell.y != parentCell.y))
+        {
+            path.points[n--] = cell;
+            cell.x += dx;
+            cell.y += dy;
+        }
+    }
+
+    path.points[0] = start;
+
+    return path;
+}
+
+// Unload maze path from memory
+void UnloadMazePath(MazePath path)
+{
+    free(path.points);
+}
+
+// Get shortest path length, -1 if no path (no path points loaded)
+int GetMazePathLength(MazePathFinder *finder, Maze maze, Point start, Point end, int method)
+{
+    return SearchMazePath(finder, maze, start, end, method);
+}
+
+// Check if end cell can be reached from start cell
+// NOTE: Uses a temporary visited cells bitmap, no path finder required
+bool IsMazeSolvable(Maze maze, Point start, Point end)
+{
+    if (!IsMazeCellWalkable(maze, start.x, start.y) || !IsMazeCellWalkable(maze, end.x, end.y)) return false;
+    if ((start.x == end.x) && (start.y == end.y)) return true;
+
+    size_t cellCount = (size_t)maze.width*maze.height;
+    unsigned char *visited = (unsigned char *)calloc((cellCount + 7)/8, 1);
+    IntArray queue = { 0 };
+    bool solvable = false;
+
+    if (visited == NULL) return false;
+
+    int startIndex = start.y*maze.width + start.x;
+    visited[startIndex >> 3] |= (1 << (startIndex & 7));
+    PushIntArray(&queue, startIndex);
+
+    for (int head = 0; (head < queue.count) && !solvable; head++)
+    {
+        int x = queue.data[head]%maze.width;
+        int y = queue.data[head]/maze.width;
+        Point neighbors[4] = { { x + 1, y }, { x - 1, y }, { x, y + 1 }, { x, y - 1 } };
+
+        for (int i = 0; i < 4; i++)
+        {
+            if (!IsMazeCellWalkable(maze, neighbors[i].x, neighbors[i].y)) continue;
+
+            int index = neighbors[i].y*maze.width + neighbors[i].x;
+
+            if (visited[index >> 3] & (1 << (index & 7))) continue;
+
+            if ((neighbors[i].x == end.x) && (neighbors[i].y == end.y)) { solvable = true; break; }
+
+            visited[index >> 3] |= (1 << (index & 7));
+            PushIntArray(&queue, index);
+        }
+    }
+
+    free(visited);
+    free(queue.data);
+
+    return solvable;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Add value to array, growing it if required
+static void PushIntArray(IntArray *array, int value)
+{
+    if (array->count >= array->capacity)
+    {
+        int capacity = (array->capacity == 0)? 256 : array->capacity*2;
+        int *data = (int *)realloc(array->data, capacity*sizeof(int));
+
+        if (data == NULL) return;
+
+        array->data = data;
+        array->capacity = capacity;
+    }
+
+    array->data[array->count++] = value;
+}
+
+// Compare (distance, index) seed pairs, for qsort()
+static int CompareDistanceSeeds(const void *a, const void *b)
+{
+    int distanceA = ((const int *)a)[0];
+    int distanceB = ((const int *)b)[0];
+
+    return (distanceA > distanceB) - (distanceA < distanceB);
+}
+
+// Reset field distances from maze cells, computing distances from goal
+static void ResetDistanceField(MazeDistanceField *field, Maze maze)
+{
+    int stride = field->width + 2;
+
+    for (int y = -1; y <= field->height; y++)
+    {
+        int *row = field->distances + (y + 1)*stride + 1;
+
+        for (int x = -1; x <= field->width; x++) row[x] = IsMazeCellWalkable(maze, x, y)? MAZE_DISTANCE_UNREACHABLE : MAZE_DISTANCE_WALL;
+    }
+
+    if (IsMazeCellWalkable(maze, field->goal.x, field->goal.y))
+    {
+        int goalIndex = (field->goal.y + 1)*stride + (field->goal.x + 1);
+
+        field->distances[goalIndex] = 0;
+        PropagateDistances(field, &goalIndex, 1);
+    }
+}
+
+// Propagate distances from seed cells, seeds must be sorted by distance
+// NOTE: Seeds and queued cells are merged in distance order (BFS order), so every cell
+// gets its final distance the first time it is reached, seeds are never queued again
+static void PropagateDistances(MazeDistanceField *field, const int *seeds, int seedCount)
+{
+    int *distances = field->distances;
+    int *queue = field->queue;
+    int stride = field->width + 2;
+    int offsets[4] = { -1, 1, -stride, stride };
+
+    int head = 0;
+    int tail = 0;
+    int nextSeed = 0;
+
+    while ((head < tail) || (nextSeed < seedCount))
+    {
+        int index = 0;
+
+        if ((nextSeed < seedCount) && ((head == tail) || (distances[seeds[nextSeed]] <= distances[queue[head]]))) index = seeds[nextSeed++];
+        else index = queue[head++];
+
+        int distance = distances[index] + 1;
+
+        for (int i = 0; i < 4; i++)
+        {
+            int neighbor = index + offsets[i];
+            int current = distances[neighbor];
+
+            if ((current == MAZE_DISTANCE_UNREACHABLE) || (current > distance))
+            {
+                distances[neighbor] = distance;
+                queue[tail++] = neighbor;
+            }
+        }
+    }
+}
+
+// Reserve path finder open list capacity (pairs)
+static bool ReserveOpenList(MazePathFinder *finder, int capacity)
+{
+    if (capacity <= finder->openCapacity) return true;
+
+    int newCapacity = (finder->openCapacity == 0)? 1024 : finder->openCapacity;
+    while (newCapacity < capacity) newCapacity *= 2;
+
+    int *open = (int *)realloc(finder->open, (size_t)newCapacity*2*sizeof(int));
+
+    if (open == NULL) return false;
+
+    finder->open = open;
+    finder->openCapacity = newCapacity;
+
+    return true;
+}
+
+// Push (key, cell) pair into open list binary heap
+static void PushOpenList(MazePathFinder *finder, int *count, int key, int cell)
+{
+    if (!ReserveOpenList(finder, *count + 1)) return;
+
+    int *heap = finder->open;
+    int i = (*count)++;
+
+    while (i > 0)
+    {
+        int parent = (i - 1)/2;
+
+        if (heap[parent*2] <= key) break;
+
+        heap[i*2] = heap[parent*2];
+        heap[i*2 + 1] = heap[parent*2 + 1];
+        i = parent;
+    }
+
+    heap[i*2] = key;
+    heap[i*2 + 1] = cell;
+}
+
+// Pop lowest key cell from open list binary heap
+static int PopOpenList(MazePathFinder *finder, int *count, int *key)
+{
+    int *heap = finder->open;
+    int cell = heap[1];
+    *key = heap[0];
+
+    int last = --(*count);
+    int lastKey = heap[last*2];
+    int lastCell = heap[last*2 + 1];
+    int i = 0;
+
+    while (true)
+    {
+        int child = i*2 + 1;
+
+        if (child >= last) break;
+        if (((child + 1) < last) && (heap[(child + 1)*2] < heap[child*2])) child++;
+        if (lastKey <= heap[child*2]) break;
+
+        heap[i*2] = heap[child*2];
+        heap[i*2 + 1] = heap[child*2 + 1];
+        i = child;
+    }
+
+    heap[i*2] = lastKey;
+    heap[i*2 + 1] = lastCell;
+
+    return cell;
+}
+
+// Jump horizontally from cell, checking forced neighbors
+// NOTE: On 4-connected grids, a vertical move after a horizontal move is only required
+// (forced) if the cell above/below the previous cell is blocked, otherwise turning earlier
+// gives a path of the same length
+static bool JumpHorizontal(Maze maze, int x, int y, int dx, Point end, int *jumpX)
+{
+    while (true)
+    {
+        x += dx;
+
+        if (!IsMazeCellWalkable(maze, x, y)) return false;
+
+        if (((x == end.x) && (y == end.y)) ||
+            (IsMazeCellWalkable(maze, x, y - 1) && !IsMazeCellWalkable(maze, x - dx, y - 1)) ||
+            (IsMazeCellWalkable(maze, x, y + 1) && !IsMazeCellWalkable(maze, x - dx, y + 1)))
+        {
+            *jumpX = x;
+            return true;
+        }
+    }
+}
+
+// Jump vertically from cell, scanning horizontally on every step
+// NOTE: Vertical moves can always be followed by horizontal moves, so a cell is a jump point
+// if any horizontal jump from it finds a jump point
+static bool JumpVertical(Maze maze, int x, int y, int dy, Point end, int *jumpY)
+{
+    int jumpX = 0;
+
+    while (true)
+    {
+        y += dy;
+
+        if (!IsMazeCellWalkable(maze, x, y)) return false;
+
+        if (((x == end.x) && (y == end.y)) ||
+            JumpHorizontal(maze, x, y, 1, end, &jumpX) ||
+            JumpHorizontal(maze, x, y, -1, end, &jumpX))
+        {
+            *jumpY = y;
+            return true;
+        }
+    }
+}
+
+// Search path, parents are set for path cells
+// NOTE: Returns path length, -1 if no path found
+static int SearchMazePath(MazePathFinder *finder, Maze maze, Point start, Point end, int method)
+{
+    if ((finder->stamps == NULL) || (maze.width != finder->width) || (maze.height != finder->height)) return -1;
+    if (!IsMazeCellWalkable(maze, start.x, start.y) || !IsMazeCellWalkable(maze, end.x, end.y)) return -1;
+
+    // New search id, nodes data from previous searches becomes invalid
+    finder->searchId++;
+    if (finder->searchId == 0)
+    {
+        for (int i = 0; i < finder->width*finder->height; i++) finder->stamps[i] = 0;
+        finder->searchId = 1;
+    }
+
+    int width = finder->width;
+    int startIndex = start.y*width + start.x;
+    int endIndex = end.y*width + end.x;
+
+    finder->stamps[startIndex] = finder->searchId;
+    finder->costs[startIndex] = 0;
+    finder->parents[startIndex] = startIndex;
+
+    if (startIndex == endIndex) return 0;
+
+    if (method == MAZE_PATH_BFS)
+    {
+        // BFS, open list used as queue of cells
+        int head = 0;
+        int tail = 0;
+
+        if (!ReserveOpenList(finder, 1)) return -1;
+        finder->open[tail++] = startIndex;
+
+        while (head < tail)
+        {
+            int cell = finder->open[head++];
+            int x = cell%width;
+            int y = cell/width;
+            Point neighbors[4] = { { x + 1, y }, { x - 1, y }, { x, y + 1 }, { x, y - 1 } };
+
+            for (int i = 0; i < 4; i++)
+            {
+                if (!IsMazeCellWalkable(maze, neighbors[i].x, neighbors[i].y)) continue;
+
+                int neighbor = neighbors[i].y*width + neighbors[i].x;
+
+                if (finder->stamps[neighbor] == finder->searchId) continue;
+
+                finder->stamps[neighbor] = finder->searchId;
+                finder->costs[neighbor] = finder->costs[cell] + 1;
+                finder->parents[neighbor] = cell;
+
+                if (neighbor == endIndex) return finder->costs[neighbor];
+
+                // NOTE: Queue is never longer than 2x the open list capacity (pairs)
+                if (!ReserveOpenList(finder, tail/2 + 1)) return -1;
+                finder->open[tail++] = neighbor;
+            }
+        }
+
+        return -1;
+    }
+
+    // A* and JPS, open list used as binary heap keyed by estimated path length
+    int openCount = 0;
+    PushOpenList(finder, &openCount, abs(end.x - start.x) + abs(end.y - start.y), startIndex);
+
+    while (openCount > 0)
+    {
+        int key = 0;
+        int cell = PopOpenList(finder, &openCount, &key);
+        int x = cell%width;
+        int y = cell/width;
+        int cost = finder->costs[cell];
+
+        // Skip outdated entries, cell reached again with a lower cost
+        if (key != (cost + abs(end.x - x) + abs(end.y - y))) continue;
+
+        if (cell == endIndex) return cost;
+
+        Point successors[4] = { 0 };
+        int successorCount = 0;
+
+        if (method == MAZE_PATH_ASTAR)
+        {
+            Point neighbors[4] = { { x + 1, y }, { x - 1, y }, { x, y + 1 }, { x, y - 1 } };
+
+            for (int i = 0; i < 4; i++)
+            {
+                if (IsMazeCellWalkable(maze, neighbors[i].x, neighbors[i].y)) successors[successorCount++] = neighbors[i];
+            }
+        }
+        else
+        {
+            // JPS: Get move direction from parent, start cell expands all directions
+            int parent = finder->parents[cell];
+            int dx = (x > parent%width) - (x < parent%width);
+            int dy = (y > parent/width) - (y < parent/width);
+            int jump = 0;
+
+            if (dy == 0)
+            {
+                // Horizontal move (or start): natural horizontal successors, vertical successors if forced
+                for (int dir = -1; dir <= 1; dir += 2)
+                {
+                    if (((dx == 0) || (dx == dir)) && JumpHorizontal(maze, x, y, dir, end, &jump)) successors[successorCount++] = (Point){ jump, y };
+                }
+
+                for (int dir = -1; dir <= 1; dir += 2)
+                {
+                    if ((dx != 0) && (!IsMazeCellWalkable(maze, x, y + dir) || IsMazeCellWalkable(maze, x - dx, y + dir))) continue;
+                    if (JumpVertical(maze, x, y, dir, end, &jump)) successors[successorCount++] = (Point){ x, jump };
+                }
+            }
+            else
+            {
+                // Vertical move: natural vertical successor and both horizontal successors
+                if (JumpVertical(maze, x, y, dy, end, &jump)) successors[successorCount++] = (Point){ x, jump };
+
+                for (int dir = -1; dir <= 1; dir += 2)
+                {
+                    if (JumpHorizontal(maze, x, y, dir, end, &jump)) successors[successorCount++] = (Point){ jump, y };
+                }
+            }
+        }
+
+        for (int i = 0; i < successorCount; i++)
+        {
+            int successor = successors[i].y*width + successors[i].x;
+            int successorCost = cost + abs(successors[i].x - x) + abs(successors[i].y - y);
+
+            if ((finder->stamps[successor] == finder->searchId) && (finder->costs[successor] <= successorCost)) continue;
+
+            finder->stamps[successor] = finder->searchId;
+            finder->costs[successor] = successorCost;
+            finder->parents[successor] = cell;
+
+            PushOpenList(finder, &openCount, successorCost + abs(end.x - successors[i].x) + abs(end.y - successors[i].y), successor);
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze pathfinding module
+*
+*   Pathfinding over the maze grid, 4-connected moves between walkable cells, unit cost:
+*
+*     - Distance fields: BFS distance from a goal cell to every maze cell, updated
+*       incrementally when maze cells are modified, for hints and bots steering
+*     - Path queries: start to end cells path, using BFS, A* or Jump Point Search (JPS),
+*       search memory is kept in a MazePathFinder and reused between queries
+*
+*   NOTE: This module only uses raylib CPU-side functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PATH_H
+#define MAZE_PATH_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, Point
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_DISTANCE_UNREACHABLE   -1      // Walkable cell not connected to distance field goal
+#define MAZE_DISTANCE_WALL          -2      // Wall cell (or out of maze bounds)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Path search method
+typedef enum {
+    MAZE_PATH_BFS = 0,          // Breadth-first search, explores all cells closer than end
+    MAZE_PATH_ASTAR,            // A* search, manhattan distance heuristic
+    MAZE_PATH_JPS               // Jump point search, A* expanding only jump points
+} MazePathMethod;
+
+// Maze distance field, distance in steps from every cell to goal cell
+// NOTE: Distances are stored with a 1 cell wall border, use GetMazeDistance() to read them
+typedef struct MazeDistanceField {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    Point goal;                 // Goal cell
+    int *distances;             // Cells distance, (width + 2)*(height + 2) values
+    int *queue;                 // Cells queue, used by field updates
+} MazeDistanceField;
+
+// Maze path, cells from start to end (both included)
+typedef struct MazePath {
+    int length;                 // Path steps (points count - 1), -1 if no path
+    Point *points;              // Path cells
+} MazePath;
+
+// Maze path finder, search memory reused between path queries
+// NOTE: Nodes data is only valid if node stamp matches current search id,
+// so it does not need to be cleared between searches
+typedef struct MazePathFinder {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    unsigned int searchId;      // Current search id
+    unsigned int *stamps;       // Search id that last reached every cell
+    int *costs;                 // Cost from start to every cell
+    int *parents;               // Parent cell index for every cell
+    int *open;                  // Open list: BFS queue or A*/JPS binary heap (cost, cell pairs)
+    int openCapacity;           // Open list capacity (pairs)
+} MazePathFinder;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Distance field functions
+MazeDistanceField LoadMazeDistanceField(Maze maze, Point goal);     // Load maze distance field to goal cell (BFS)
+MazeDistanceField LoadMazeDistanceFieldGoals(Maze maze, const Point *goals, int goalCount); // Load maze distance field to nearest of several goal cells (multi-source BFS)
+void UnloadMazeDistanceField(MazeDistanceField field);              // Unload maze distance field from memory
+void UpdateMazeDistanceField(MazeDistanceField *field, Maze maze, Rectangle cells); // Update distance field for a modified maze cells region
+int GetMazeDistance(MazeDistanceField field, int x, int y);         // Get cell distance to goal (or MAZE_DISTANCE_UNREACHABLE/MAZE_DISTANCE_WALL)
+Point GetMazeDistanceStep(MazeDistanceField field, Point cell);     // Get next cell towards goal, same cell if goal or unreachable
+
+// Path queries functions
+MazePathFinder LoadMazePathFinder(Maze maze);                       // Load maze path finder, search memory for maze size
+void UnloadMazePathFinder(MazePathFinder finder);                   // Unload maze path finder from memory
+MazePath LoadMazePath(MazePathFinder *finder, Maze maze, Point start, Point end, int method); // Load path from start to end cell, length is -1 if no path
+void UnloadMazePath(MazePath path);                                 // Unload maze path from memory
+int GetMazePathLength(MazePathFinder *finder, Maze maze, Point start, Point end, int method); // Get shortest path length, -1 if no path (no path points loaded)
+bool IsMazeSolvable(Maze maze, Point start, Point end);             // Check if end cell can be reached from start cell
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_PATH_H
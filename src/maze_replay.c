@@ -0,0 +1,228 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze game replay module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_replay.h"
+
+#include <stdio.h>      // Required for: FILE, fopen(), fread(), fwrite(), fclose()
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <string.h>     // Required for: memcmp(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_REPLAY_RUN_MAX_LENGTH  4096    // Maximum ticks per input run (12bit length)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Start replay recording, storing maze, items and start state
+// NOTE: Items picked state is not stored, all items are available on replay start
+MazeReplay StartMazeReplayRecording(Maze maze, MazeItems items, MazeSim sim, unsigned int seed)
+{
+    MazeReplay replay = { 0 };
+
+    memcpy(replay.header.id, "MRPL", 4);
+    replay.header.version = MAZE_REPLAY_VERSION;
+    replay.header.headerSize = sizeof(MazeReplayHeader);
+    replay.header.seed = seed;
+    replay.header.width = maze.width;
+    replay.header.height = maze.height;
+    replay.header.mazeHash = GetMazeHash(maze);
+    replay.header.startX = sim.startCell.x;
+    replay.header.startY = sim.startCell.y;
+    replay.header.endX = sim.endCell.x;
+    replay.header.endY = sim.endCell.y;
+    replay.header.finalX = sim.playerCell.x;
+    replay.header.finalY = sim.playerCell.y;
+
+    if (items.count > 0)
+    {
+        replay.items = (Point *)malloc(items.count*sizeof(Point));
+
+        if (replay.items != NULL)
+        {
+            memcpy(replay.items, items.cells, items.count*sizeof(Point));
+            replay.header.itemCount = items.count;
+        }
+    }
+
+    return replay;
+}
+
+// Record input buttons for one simulation tick
+// NOTE: Input is appended to last run if buttons are the same and run is not full
+void RecordMazeReplayInput(MazeReplay *replay, unsigned int input)
+{
+    input &= 0xf;
+
+    if (replay->header.runCount > 0)
+    {
+        unsigned short *run = &replay->runs[replay->header.runCount - 1];
+
+        if (((*run & 0xf) == input) && (((*run >> 4) + 1) < MAZE_REPLAY_RUN_MAX_LENGTH))
+        {
+            *run += (1 << 4);
+            replay->header.tickCount++;
+            return;
+        }
+    }
+
+    if ((int)replay->header.runCount >= replay->runCapacity)
+    {
+        int capacity = (replay->runCapacity == 0)? 256 : replay->runCapacity*2;
+        unsigned short *runs = (unsigned short *)realloc(replay->runs, capacity*sizeof(unsigned short));
+
+        if (runs == NULL) return;
+
+        replay->runs = runs;
+        replay->runCapacity = capacity;
+    }
+
+    replay->runs[replay->header.runCount++] = (unsigned short)input;
+    replay->header.tickCount++;
+}
+
+// Stop replay recording, storing final simulation state
+void StopMazeReplayRecording(MazeReplay *replay, MazeSim sim)
+{
+    replay->header.finalX = sim.playerCell.x;
+    replay->header.finalY = sim.playerCell.y;
+    replay->header.finalScore = sim.score;
+}
+
+// Load replay from file
+MazeReplay LoadMazeReplay(const char *fileName)
+{
+    MazeReplay replay = { 0 };
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] Failed to open replay file", fileName);
+        return replay;
+    }
+
+    bool valid = (fread(&replay.header, sizeof(MazeReplayHeader), 1, file) == 1) && (memcmp(replay.header.id, "MRPL", 4) == 0) &&
+        (replay.header.version <= MAZE_REPLAY_VERSION) && (replay.header.headerSize >= sizeof(MazeReplayHeader)) &&
+        (replay.header.width > 0) && (replay.header.height > 0) && (replay.header.width <= MAZE_MAX_SIZE) && (replay.header.height <= MAZE_MAX_SIZE) &&
+        (replay.header.itemCount <= (unsigned int)MAZE_MAX_SIZE*MAZE_MAX_SIZE) && (fseek(file, replay.header.headerSize, SEEK_SET) == 0);
+
+    if (valid && (replay.header.itemCount > 0))
+    {
+        replay.items = (Point *)malloc(replay.header.itemCount*sizeof(Point));
+        valid = (replay.items != NULL) && (fread(replay.items, sizeof(Point), replay.header.itemCount, file) == replay.header.itemCount);
+    }
+
+    if (valid && (replay.header.runCount > 0))
+    {
+        replay.runs = (unsigned short *)malloc(replay.header.runCount*sizeof(unsigned short));
+        valid = (replay.runs != NULL) && (fread(replay.runs, sizeof(unsigned short), replay.header.runCount, file) == replay.header.runCount);
+        replay.runCapacity = replay.header.runCount;
+    }
+
+    // Input runs must add up to recorded ticks
+    if (valid)
+    {
+        unsigned long long tickCount = 0;
+        for (unsigned int i = 0; i < replay.header.runCount; i++) tickCount += (replay.runs[i] >> 4) + 1;
+        valid = (tickCount == replay.header.tickCount);
+    }
+
+    fclose(file);
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] Replay file not valid", fileName);
+        UnloadMazeReplay(replay);
+        return (MazeReplay){ 0 };
+    }
+
+    TraceLog(LOG_INFO, "REPLAY: [%s] Replay file loaded successfully (%u ticks, %u runs)", fileName, replay.header.tickCount, replay.header.runCount);
+
+    return replay;
+}
+
+// Unload replay from memory
+void UnloadMazeReplay(MazeReplay replay)
+{
+    free(replay.items);
+    free(replay.runs);
+}
+
+// Export replay to file
+bool ExportMazeReplay(MazeReplay replay, const char *fileName)
+{
+    if (!IsMazeReplayValid(replay)) return false;
+
+    FILE *file = fopen(fileName, "wb");
+    bool success = false;
+
+    if (file != NULL)
+    {
+        MazeReplayHeader header = replay.header;
+        header.headerSize = sizeof(MazeReplayHeader);
+
+        success = (fwrite(&header, sizeof(MazeReplayHeader), 1, file) == 1) &&
+            (fwrite(replay.items, sizeof(Point), header.itemCount, file) == header.itemCount) &&
+            (fwrite(replay.runs, sizeof(unsigned short), header.runCount, file) == header.runCount);
+
+        success = (fclose(file) == 0) && success;
+    }
+
+    if (success) TraceLog(LOG_INFO, "REPLAY: [%s] Replay file saved successfully (%u ticks, %u runs)", fileName, replay.header.tickCount, replay.header.runCount);
+    else TraceLog(LOG_WARNING, "REPLAY: [%s] Failed to save replay file", fileName);
+
+    return success;
+}
+
+// Check if replay is valid (loaded or recorded)
+bool IsMazeReplayValid(MazeReplay replay)
+{
+    return (memcmp(replay.header.id, "MRPL", 4) == 0);
+}
+
+// Rewind replay playback to first tick
+void RewindMazeReplay(MazeReplay *replay)
+{
+    replay->playRun = 0;
+    replay->playRunTick = 0;
+    replay->playTick = 0;
+}
+
+// Get next tick input buttons, 0 once finished
+unsigned int PlayMazeReplayInput(MazeReplay *replay)
+{
+    if (replay->playRun >= replay->header.runCount) return 0;
+
+    unsigned short run = replay->runs[replay->playRun];
+
+    replay->playTick++;
+    replay->playRunTick++;
+
+    if (replay->playRunTick > (unsigned int)(run >> 4))
+    {
+        replay->playRun++;
+        replay->playRunTick = 0;
+    }
+
+    return (run & 0xf);
+}
+
+// Check if replay playback has played all ticks
+bool IsMazeReplayFinished(MazeReplay replay)
+{
+    return (replay.playTick >= replay.header.tickCount);
+}
+
+// Check simulation state equals replay final state
+// NOTE: Simulation ticks stop once finished, so recording stops on finish
+bool IsMazeReplayStateEqual(MazeReplay replay, MazeSim sim)
+{
+    return ((sim.playerCell.x == replay.header.finalX) && (sim.playerCell.y == replay.header.finalY) &&
+        (sim.score == replay.header.finalScore) && (sim.tick == replay.header.tickCount));
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze game replay module
+*
+*   Game sessions recorded as per-tick input buttons, replayed deterministically by the
+*   game simulation (maze_sim): same maze, items and inputs always reach the same state
+*
+*   Replay data: maze seed and size (maze is generated again from seed, checked by hash),
+*   start and end cells, items cells, input runs and final simulation state, used to
+*   verify replays reach the recorded state
+*
+*   Input is stored run-length encoded, 16bit per run: bits 0..3 input buttons,
+*   bits 4..15 run length - 1 (4096 ticks max per run)
+*
+*   Replay file format (.mrpl), little-endian:
+*
+*       Offset  Size                Data
+*       0       64                  Header (MazeReplayHeader)
+*       64      itemCount*8         Items table, cells (x, y)
+*       ...     runCount*2          Input runs
+*
+*   NOTE: This module only uses raylib CPU-side functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_REPLAY_H
+#define MAZE_REPLAY_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, Point
+#include "maze_items.h"     // Required for: MazeItems
+#include "maze_sim.h"       // Required for: MazeSim
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_REPLAY_VERSION         1       // Current replay file version
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze replay file header, stored at file start
+typedef struct MazeReplayHeader {
+    char id[4];                 // File identifier: "MRPL"
+    unsigned short version;     // File version (MAZE_REPLAY_VERSION)
+    unsigned short headerSize;  // Header size in bytes
+    unsigned int seed;          // Maze generation seed
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    unsigned int mazeHash;      // Maze cells hash (GetMazeHash())
+    int startX;                 // Player start cell x
+    int startY;                 // Player start cell y
+    int endX;                   // End-point cell x
+    int endY;                   // End-point cell y
+    unsigned int itemCount;     // Items table count
+    unsigned int runCount;      // Input runs count
+    unsigned int tickCount;     // Recorded ticks count
+    int finalX;                 // Final player cell x
+    int finalY;                 // Final player cell y
+    int finalScore;             // Final score
+} MazeReplayHeader;
+
+// Maze replay, recorded session
+typedef struct MazeReplay {
+    MazeReplayHeader header;    // Replay header, maze and final state data
+    Point *items;               // Items cells at session start
+    unsigned short *runs;       // Input runs
+    int runCapacity;            // Input runs capacity, while recording
+    unsigned int playRun;       // Playback current run
+    unsigned int playRunTick;   // Playback current run tick
+    unsigned int playTick;      // Playback current tick
+} MazeReplay;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Replay recording, simulation must be at its initial state when recording starts
+MazeReplay StartMazeReplayRecording(Maze maze, MazeItems items, MazeSim sim, unsigned int seed); // Start replay recording, storing maze, items and start state
+void RecordMazeReplayInput(MazeReplay *replay, unsigned int input); // Record input buttons for one simulation tick
+void StopMazeReplayRecording(MazeReplay *replay, MazeSim sim); // Stop replay recording, storing final simulation state
+
+// Replay loading/unloading
+MazeReplay LoadMazeReplay(const char *fileName);            // Load replay from file
+void UnloadMazeReplay(MazeReplay replay);                   // Unload replay from memory
+bool ExportMazeReplay(MazeReplay replay, const char *fileName); // Export replay to file
+bool IsMazeReplayValid(MazeReplay replay);                  // Check if replay is valid (loaded or recorded)
+
+// Replay playback, one input per simulation tick
+void RewindMazeReplay(MazeReplay *replay);                  // Rewind replay playback to first tick
+unsigned int PlayMazeReplayInput(MazeReplay *replay);       // Get next tick input buttons, 0 once finished
+bool IsMazeReplayFinished(MazeReplay replay);               // Check if replay playback has played all ticks
+bool IsMazeReplayStateEqual(MazeReplay replay, MazeSim sim); // Check simulation state equals replay final state
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_REPLAY_H
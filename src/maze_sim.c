@@ -0,0 +1,81 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze game simulation module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_sim.h"
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init maze game simulation, player at start cell
+MazeSim InitMazeSim(Point startCell, Point endCell)
+{
+    MazeSim sim = { 0 };
+
+    sim.startCell = startCell;
+    sim.endCell = endCell;
+    sim.playerCell = startCell;
+    sim.previousCell = startCell;
+
+    return sim;
+}
+
+// Update maze game simulation one tick (only sim and items are modified)
+// NOTE: Finished simulations are not updated anymore, tick keeps the finish time
+void UpdateMazeSim(MazeSim *sim, Maze maze, MazeItems *items, unsigned int input)
+{
+    sim->events = 0;
+    sim->previousCell = sim->playerCell;
+
+    if (sim->finished) return;
+
+    sim->tick++;
+
+    // Player movement, one cell per step, walls block movement
+    if (sim->moveTicks > 0) sim->moveTicks--;
+
+    Point direction = { 0 };
+
+    if (input & MAZE_INPUT_RIGHT) direction.x = 1;
+    else if (input & MAZE_INPUT_LEFT) direction.x = -1;
+    else if (input & MAZE_INPUT_DOWN) direction.y = 1;
+    else if (input & MAZE_INPUT_UP) direction.y = -1;
+
+    if (((direction.x != 0) || (direction.y != 0)) && (sim->moveTicks == 0) &&
+        IsMazeCellWalkable(maze, sim->playerCell.x + direction.x, sim->playerCell.y + direction.y))
+    {
+        sim->playerCell.x += direction.x;
+        sim->playerCell.y += direction.y;
+        sim->moveTicks = MAZE_SIM_MOVE_TICKS;
+    }
+
+    // Items pickup, every item can only be picked once
+    if ((items != NULL) && (PickMazeItem(items, sim->playerCell) >= 0))
+    {
+        sim->score++;
+        sim->events |= MAZE_SIM_EVENT_ITEM_PICKED;
+    }
+
+    // End-point detection
+    if (((sim->playerCell.x == sim->endCell.x) && (sim->playerCell.y == sim->endCell.y)) ||
+        (GetMazeCell(maze, sim->playerCell.x, sim->playerCell.y) == MAZE_CELL_END))
+    {
+        sim->finished = true;
+        sim->events |= MAZE_SIM_EVENT_FINISHED;
+    }
+}
+
+// Get player position in cells, interpolated between last two ticks [0.0f..1.0f]
+Vector2 GetMazeSimPlayerPosition(MazeSim sim, float alpha)
+{
+    Vector2 position = {
+        sim.previousCell.x + (sim.playerCell.x - sim.previousCell.x)*alpha,
+        sim.previousCell.y + (sim.playerCell.y - sim.previousCell.y)*alpha
+    };
+
+    return position;
+}
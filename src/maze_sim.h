@@ -0,0 +1,80 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze game simulation module
+*
+*   Game logic (player movement, collisions, items pickup and end-point detection) as a
+*   pure simulation stepped at a fixed tick rate: every tick only depends on previous
+*   simulation state, maze cells, items and player input buttons for that tick
+*
+*   Simulation is decoupled from rendering: window, input devices and frame time are not
+*   used, so it can run headless and faster than real time (soak tests, bots)
+*
+*   NOTE: This module only uses raylib CPU-side functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_SIM_H
+#define MAZE_SIM_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, Point
+#include "maze_items.h"     // Required for: MazeItems
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_SIM_TICK_RATE          60      // Simulation ticks per second
+#define MAZE_SIM_TICK_TIME          (1.0f/MAZE_SIM_TICK_RATE)   // Simulation tick time in seconds
+#define MAZE_SIM_MOVE_TICKS         1       // Ticks per player cell step while moving
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Player input buttons, combined as flags for every tick
+// NOTE: Only one direction is applied per tick: right, left, down, up (priority order)
+typedef enum {
+    MAZE_INPUT_RIGHT    = 1,
+    MAZE_INPUT_LEFT     = 2,
+    MAZE_INPUT_DOWN     = 4,
+    MAZE_INPUT_UP       = 8
+} MazeInputButton;
+
+// Simulation events, combined as flags, raised by last tick
+typedef enum {
+    MAZE_SIM_EVENT_ITEM_PICKED  = 1,    // Player picked an item
+    MAZE_SIM_EVENT_FINISHED     = 2     // Player reached an end-point
+} MazeSimEvent;
+
+// Maze game simulation state
+typedef struct MazeSim {
+    unsigned int tick;          // Simulated ticks count, stopped when finished
+    Point startCell;            // Player start cell
+    Point endCell;              // End-point cell (MAZE_CELL_END cells also finish the game)
+    Point playerCell;           // Player cell
+    Point previousCell;         // Player cell before last tick, for rendering interpolation
+    int moveTicks;              // Ticks until player can move again
+    int score;                  // Picked items count
+    bool finished;              // Player reached an end-point
+    unsigned int events;        // Events raised by last tick (MazeSimEvent flags)
+} MazeSim;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeSim InitMazeSim(Point startCell, Point endCell);        // Init maze game simulation, player at start cell
+void UpdateMazeSim(MazeSim *sim, Maze maze, MazeItems *items, unsigned int input); // Update maze game simulation one tick (only sim and items are modified)
+Vector2 GetMazeSimPlayerPosition(MazeSim sim, float alpha); // Get player position in cells, interpolated between last two ticks [0.0f..1.0f]
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_SIM_H
@@ -0,0 +1,255 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze streaming generation module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_stream.h"
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <string.h>         // Required for: memset(), memcpy(), memmove()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_STREAM_JOIN_CHANCE     128     // Chance (over 256) to join adjacent cells of different sets (50%)
+#define MAZE_STREAM_DOWN_CHANCE     102     // Chance (over 256) of a vertical passage for every cell (40%)
+
+#define MAZE_STREAM_SET_USED        1       // Set flag: set id used in current row
+#define MAZE_STREAM_SET_DOWN        2       // Set flag: set has a vertical passage
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void GenMazeStreamCells(MazeStream *stream, unsigned char *cells); // Generate cells row, horizontal and vertical passages
+static int FindMazeStreamSet(MazeStream *stream, int set);  // Find merged set root, compressing path
+static bool GetMazeStreamChance(MazeStream *stream, int chance); // Check random chance (over 256), one random byte consumed
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze stream generator, rows of width cells (max: MAZE_MAX_SIZE)
+// NOTE: Set ids are reused between rows, a row uses at most one set per cell
+MazeStream LoadMazeStream(int width, unsigned int seed)
+{
+    MazeStream stream = { 0 };
+
+    if ((width < 3) || (width > MAZE_MAX_SIZE))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Invalid maze stream width (%i), valid range: [3..%i]", width, MAZE_MAX_SIZE);
+        return stream;
+    }
+
+    int columns = (width - 1)/2;
+
+    stream.sets = (int *)calloc(columns, sizeof(int));
+    stream.parents = (int *)calloc(columns + 1, sizeof(int));
+    stream.lastColumns = (int *)calloc(columns + 1, sizeof(int));
+    stream.flags = (unsigned char *)calloc(columns + 1, sizeof(unsigned char));
+    stream.down = (unsigned char *)calloc(columns, sizeof(unsigned char));
+    stream.row = (unsigned char *)malloc(width);
+
+    if ((stream.sets == NULL) || (stream.parents == NULL) || (stream.lastColumns == NULL) ||
+        (stream.flags == NULL) || (stream.down == NULL) || (stream.row == NULL))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to allocate maze stream (width: %i)", width);
+        UnloadMazeStream(&stream);
+        return stream;
+    }
+
+    stream.width = width;
+    stream.columns = columns;
+    SetMazeRandomSeed(&stream.random, seed);
+
+    return stream;
+}
+
+// Unload maze stream generator from memory
+void UnloadMazeStream(MazeStream *stream)
+{
+    free(stream->sets);
+    free(stream->parents);
+    free(stream->lastColumns);
+    free(stream->flags);
+    free(stream->down);
+    free(stream->row);
+
+    *stream = (MazeStream){ 0 };
+}
+
+// Generate next maze row, width cells (MazeCellType)
+void GenMazeStreamRow(MazeStream *stream, unsigned char *cells)
+{
+    if (stream->width == 0) return;
+
+    unsigned int row = stream->rowCount++;
+
+    memset(cells, MAZE_CELL_WALL, stream->width);
+
+    if (row == 0) return;       // Top border
+    else if (row & 1) GenMazeStreamCells(stream, cells);
+    else
+    {
+        // Passages row, vertical passages set by previous cells row
+        for (int c = 0; c < stream->columns; c++)
+        {
+            if (stream->down[c]) cells[2*c + 1] = MAZE_CELL_FLOOR;
+        }
+    }
+}
+
+// Generate next maze rows into maze rows, starting at startY
+// NOTE: Rows are copied into maze chunks, rows out of maze bounds are generated but not stored
+void GenMazeStreamRows(MazeStream *stream, Maze *maze, int startY, int rowCount)
+{
+    if ((stream->width == 0) || (maze->cells == NULL)) return;
+
+    int width = (stream->width < maze->width)? stream->width : maze->width;
+
+    for (int y = startY; y < (startY + rowCount); y++)
+    {
+        GenMazeStreamRow(stream, stream->row);
+
+        if ((y < 0) || (y >= maze->height)) continue;
+
+        for (int cx = 0; cx < maze->chunksX; cx++)
+        {
+            int x = cx*MAZE_CHUNK_SIZE;
+
+            if (x >= width) break;
+
+            int count = ((width - x) < MAZE_CHUNK_SIZE)? (width - x) : MAZE_CHUNK_SIZE;
+            memcpy(maze->cells + GetMazeCellIndex(*maze, x, y), stream->row + x, count);
+        }
+    }
+}
+
+// Generate maze window, next height rows from stream
+Maze GenMazeStreamWindow(MazeStream *stream, int height)
+{
+    Maze maze = GenMazeEmpty(stream->width, height);
+
+    if (maze.cells != NULL) GenMazeStreamRows(stream, &maze, 0, height);
+
+    return maze;
+}
+
+// Scroll maze window up by chunk rows, evicted rows replaced by next rows at bottom
+// NOTE: Maze height should be a multiple of chunk size, so rows keep their chunk row position
+void ScrollMazeStreamWindow(MazeStream *stream, Maze *maze, int chunkRows)
+{
+    if ((maze->cells == NULL) || (chunkRows <= 0)) return;
+    if (chunkRows > maze->chunksY) chunkRows = maze->chunksY;
+
+    size_t chunkRowSize = (size_t)maze->chunksX*MAZE_CHUNK_CELLS;
+
+    // Chunk rows moved up at once, chunks data is contiguous by chunk rows
+    memmove(maze->cells, maze->cells + chunkRows*chunkRowSize, (maze->chunksY - chunkRows)*chunkRowSize);
+
+    GenMazeStreamRows(stream, maze, maze->height - chunkRows*MAZE_CHUNK_SIZE, chunkRows*MAZE_CHUNK_SIZE);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Generate cells row, horizontal and vertical passages
+// NOTE: Sets merged in a row are tracked with union-find, so a merge does not relabel
+// the whole row, set ids are compressed to roots once horizontal passages are done
+static void GenMazeStreamCells(MazeStream *stream, unsigned char *cells)
+{
+    int columns = stream->columns;
+    int *sets = stream->sets;
+    unsigned char *flags = stream->flags;
+
+    // STEP 1: Cells not connected from previous row get a new set id
+    memset(flags, 0, columns + 1);
+    for (int c = 0; c < columns; c++) flags[sets[c]] |= MAZE_STREAM_SET_USED;
+
+    int nextSet = 1;
+
+    for (int c = 0; c < columns; c++)
+    {
+        if (sets[c] == 0)
+        {
+            while (flags[nextSet] & MAZE_STREAM_SET_USED) nextSet++;
+
+            sets[c] = nextSet;
+            flags[nextSet] |= MAZE_STREAM_SET_USED;
+        }
+
+        stream->parents[sets[c]] = sets[c];
+        cells[2*c + 1] = MAZE_CELL_FLOOR;
+    }
+
+    // STEP 2: Horizontal passages, randomly joining adjacent cells of different sets
+    // NOTE: Left cell root is carried from previous column, only right cell root is searched,
+    // join is computed without branches, random decisions can not be predicted
+    int left = FindMazeStreamSet(stream, sets[0]);
+
+    for (int c = 0; c < (columns - 1); c++)
+    {
+        int right = FindMazeStreamSet(stream, sets[c + 1]);
+        int join = (left != right) & GetMazeStreamChance(stream, MAZE_STREAM_JOIN_CHANCE);
+
+        stream->parents[right] = join? left : right;
+        cells[2*c + 2] = join? MAZE_CELL_FLOOR : MAZE_CELL_WALL;
+        left = join? left : right;
+    }
+
+    for (int c = 0; c < columns; c++)
+    {
+        sets[c] = FindMazeStreamSet(stream, sets[c]);
+        stream->lastColumns[sets[c]] = c;
+    }
+
+    // STEP 3: Vertical passages, random cells and at least one per set (set last cell)
+    for (int c = 0; c < columns; c++)
+    {
+        int down = GetMazeStreamChance(stream, MAZE_STREAM_DOWN_CHANCE);
+
+        down |= (stream->lastColumns[sets[c]] == c) && !(flags[sets[c]] & MAZE_STREAM_SET_DOWN);
+        flags[sets[c]] |= (down? MAZE_STREAM_SET_DOWN : 0);
+        stream->down[c] = (unsigned char)down;
+    }
+
+    // Cells without vertical passage are not connected to next row
+    for (int c = 0; c < columns; c++)
+    {
+        if (!stream->down[c]) sets[c] = 0;
+    }
+}
+
+// Find merged set root, compressing path
+static int FindMazeStreamSet(MazeStream *stream, int set)
+{
+    int *parents = stream->parents;
+
+    while (parents[set] != set)
+    {
+        parents[set] = parents[parents[set]];
+        set = parents[set];
+    }
+
+    return set;
+}
+
+// Check random chance (over 256), one random byte consumed
+// NOTE: Every random value provides 3 random bytes, decisions are taken for every cell
+// so a full random value per decision would dominate generation time
+static bool GetMazeStreamChance(MazeStream *stream, int chance)
+{
+    if (stream->randomBytes == 0)
+    {
+        stream->randomBits = (unsigned int)GetMazeRandomValue(&stream->random, 0, 0xffffff);
+        stream->randomBytes = 3;
+    }
+
+    int value = (int)(stream->randomBits & 0xff);
+
+    stream->randomBits >>= 8;
+    stream->randomBytes--;
+
+    return (value < chance);
+}
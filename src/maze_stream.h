@@ -0,0 +1,77 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze streaming generation module
+*
+*   Unbounded mazes generated one row at a time using Eller's algorithm, only current row
+*   state is kept (cells sets and vertical passages), so memory depends on maze width only
+*   and rows can be generated forever
+*
+*   Maze cells are placed on odd coordinates, walls and passages between them:
+*
+*       Row 0           Top border, all walls
+*       Rows 1, 3, ...  Cells row: cells and horizontal passages joining different sets
+*       Rows 2, 4, ...  Passages row: vertical passages, at least one per set
+*
+*   Generated rows form a perfect maze (no loops), last row is never closed: every set
+*   continues to next row, so any cell can always reach the last generated row
+*
+*   Maze windows: a fixed height maze scrolled by chunk rows, rows behind are evicted and
+*   new rows generated at the bottom, for endless maze scrolling
+*
+*   NOTE: A cell could reach next rows only through evicted rows, sets rarely keep apart
+*   that long, keep enough rows behind the player to make it unlikely
+*
+*   NOTE: This module only uses raylib CPU-side functionality, it does not require
+*   a window or an audio device initialized, so it can be used from command line tools
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_STREAM_H
+#define MAZE_STREAM_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, MazeRandom
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze stream generator state (Eller's algorithm)
+// NOTE: All arrays size depends on maze width only
+typedef struct MazeStream {
+    int width;                  // Rows width in cells
+    int columns;                // Maze cells per row, placed on odd columns
+    unsigned int rowCount;      // Generated rows count, next row index
+    MazeRandom random;          // Random generator, seeded with stream seed
+    unsigned int randomBits;    // Random bytes not used yet, from last random value
+    int randomBytes;            // Random bytes count not used yet
+    int *sets;                  // Cells set id in current row, 0 if not connected from previous row
+    int *parents;               // Sets union-find parents, merged sets in current row
+    int *lastColumns;           // Sets last column in current row
+    unsigned char *flags;       // Sets flags: used, vertical passage added
+    unsigned char *down;        // Cells vertical passage to next row
+    unsigned char *row;         // Row cells buffer, used to fill maze rows
+} MazeStream;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeStream LoadMazeStream(int width, unsigned int seed);    // Load maze stream generator, rows of width cells (max: MAZE_MAX_SIZE)
+void UnloadMazeStream(MazeStream *stream);                  // Unload maze stream generator from memory
+void GenMazeStreamRow(MazeStream *stream, unsigned char *cells); // Generate next maze row, width cells (MazeCellType)
+void GenMazeStreamRows(MazeStream *stream, Maze *maze, int startY, int rowCount); // Generate next maze rows into maze rows, starting at startY
+
+Maze GenMazeStreamWindow(MazeStream *stream, int height);   // Generate maze window, next height rows from stream
+void ScrollMazeStreamWindow(MazeStream *stream, Maze *maze, int chunkRows); // Scroll maze window up by chunk rows, evicted rows replaced by next rows at bottom
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_STREAM_H
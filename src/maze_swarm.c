@@ -0,0 +1,547 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze bots swarm module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_swarm.h"
+
+#include "raymath.h"        // Required for: MatrixIdentity()
+
+#include "maze_path.h"      // Required for: LoadMazeDistanceFieldGoals(), GetMazeDistance()
+#include "maze_tiles.h"     // Required for: MAZE_TILES_MAX_QUADS
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_FLOW_JOB_ROWS          64      // Flow field rows generated per job
+#define MAZE_SWARM_MAX_STEPS        4       // Maximum cells a bot moves in a single update
+#define MAZE_SWARM_SPAWN_TRIES      32      // Random cells tried to respawn a bot
+#define MAZE_SWARM_MIN_SPEED        4.0f    // Bots minimum speed in cells per second
+#define MAZE_SWARM_MAX_SPEED        12.0f   // Bots maximum speed in cells per second
+#define MAZE_SWARM_BOT_SIZE         0.5f    // Bots quad size in cells
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Flow field generation jobs data
+typedef struct MazeFlowJobs {
+    MazeFlowField *field;
+    MazeDistanceField distances;
+} MazeFlowJobs;
+
+// Swarm update jobs data
+typedef struct MazeSwarmJobs {
+    MazeSwarm *swarm;
+    Maze maze;
+    float deltaTime;
+} MazeSwarmJobs;
+
+// Swarm batch vertices jobs data
+typedef struct MazeSwarmBatchJobs {
+    MazeSwarmBatch *batch;
+    const MazeSwarm *swarm;
+    Vector2 position;
+    float scale;
+} MazeSwarmBatchJobs;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void GenMazeFlowRowsJob(void *data, int index);     // Generate flow field rows directions, job function
+static void UpdateMazeSwarmJob(void *data, int index);     // Update swarm bots range, job function
+static void GenMazeSwarmVerticesJob(void *data, int index); // Generate swarm bots range quads vertices, job function
+
+static unsigned int GetBotRandom(unsigned int *state);      // Get next bot random value (xorshift32)
+static void SpawnMazeSwarmBot(MazeSwarm *swarm, Maze maze, int index); // Spawn bot at a random walkable cell, bot kept at its cell if none found
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Flow field
+//----------------------------------------------------------------------------------
+// Load flow field to nearest goal cell (pool can be NULL)
+// NOTE: Field is computed from a temporary multi-goal distance field, every cell points to
+// the first neighbor one step closer to goal, rows generated in parallel
+MazeFlowField LoadMazeFlowField(Maze maze, const Point *goals, int goalCount, JobPool *pool)
+{
+    MazeFlowField field = { 0 };
+
+    MazeDistanceField distances = LoadMazeDistanceFieldGoals(maze, goals, goalCount);
+
+    if (distances.distances == NULL) return field;
+
+    field.directions = (unsigned char *)malloc((size_t)maze.width*maze.height);
+
+    if (field.directions == NULL)
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to allocate flow field (%ix%i)", maze.width, maze.height);
+        UnloadMazeDistanceField(distances);
+        return field;
+    }
+
+    field.width = maze.width;
+    field.height = maze.height;
+
+    MazeFlowJobs jobs = { &field, distances };
+    RunJobs(pool, (maze.height + MAZE_FLOW_JOB_ROWS - 1)/MAZE_FLOW_JOB_ROWS, GenMazeFlowRowsJob, &jobs);
+
+    UnloadMazeDistanceField(distances);
+
+    return field;
+}
+
+// Unload flow field from memory
+void UnloadMazeFlowField(MazeFlowField field)
+{
+    free(field.directions);
+}
+
+// Get cell flow direction (MazeFlowDirection), MAZE_FLOW_NONE out of bounds
+int GetMazeFlowDirection(MazeFlowField field, int x, int y)
+{
+    if ((field.directions == NULL) || (x < 0) || (y < 0) || (x >= field.width) || (y >= field.height)) return MAZE_FLOW_NONE;
+
+    return field.directions[y*field.width + x];
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Swarm
+//----------------------------------------------------------------------------------
+// Load swarm, bots spawned at random walkable cells
+// NOTE: Bots goals alternate between end-point and items, speeds are random
+MazeSwarm LoadMazeSwarm(Maze maze, Point endCell, MazeItems items, int count, unsigned int seed, JobPool *pool)
+{
+    MazeSwarm swarm = { 0 };
+
+    if ((maze.cells == NULL) || (count <= 0)) return swarm;
+
+    swarm.cellsX = (int *)malloc(count*sizeof(int));
+    swarm.cellsY = (int *)malloc(count*sizeof(int));
+    swarm.progress = (float *)calloc(count, sizeof(float));
+    swarm.speeds = (float *)malloc(count*sizeof(float));
+    swarm.directions = (unsigned char *)malloc(count);
+    swarm.goals = (unsigned char *)malloc(count);
+    swarm.randoms = (unsigned int *)malloc(count*sizeof(unsigned int));
+    swarm.jobArrivals = (int *)calloc((count + MAZE_SWARM_JOB_BOTS - 1)/MAZE_SWARM_JOB_BOTS, sizeof(int));
+
+    if ((swarm.cellsX == NULL) || (swarm.cellsY == NULL) || (swarm.progress == NULL) || (swarm.speeds == NULL) ||
+        (swarm.directions == NULL) || (swarm.goals == NULL) || (swarm.randoms == NULL) || (swarm.jobArrivals == NULL))
+    {
+        TraceLog(LOG_WARNING, "MAZE: Failed to allocate swarm (%i bots)", count);
+        UnloadMazeSwarm(&swarm);
+        return (MazeSwarm){ 0 };
+    }
+
+    swarm.count = count;
+
+    for (int i = 0; i < count; i++)
+    {
+        // Bot random generator seeded from swarm seed and bot index, never zero
+        swarm.randoms[i] = (seed ^ ((unsigned int)i*0x9e3779b1u)) | 1;
+
+        swarm.cellsX[i] = 0;
+        swarm.cellsY[i] = 0;
+        swarm.speeds[i] = MAZE_SWARM_MIN_SPEED + (MAZE_SWARM_MAX_SPEED - MAZE_SWARM_MIN_SPEED)*(GetBotRandom(&swarm.randoms[i]) & 0xffff)/65535.0f;
+        swarm.directions[i] = MAZE_FLOW_NONE;
+        swarm.goals[i] = (unsigned char)(i%MAZE_BOT_GOAL_COUNT);
+
+        SpawnMazeSwarmBot(&swarm, maze, i);
+    }
+
+    UpdateMazeSwarmGoals(&swarm, maze, endCell, items, pool);
+
+    return swarm;
+}
+
+// Unload swarm from memory
+void UnloadMazeSwarm(MazeSwarm *swarm)
+{
+    free(swarm->cellsX);
+    free(swarm->cellsY);
+    free(swarm->progress);
+    free(swarm->speeds);
+    free(swarm->directions);
+    free(swarm->goals);
+    free(swarm->randoms);
+    free(swarm->jobArrivals);
+
+    for (int i = 0; i < MAZE_BOT_GOAL_COUNT; i++) UnloadMazeFlowField(swarm->fields[i]);
+
+    *swarm = (MazeSwarm){ 0 };
+}
+
+// Update swarm flow fields, required if maze cells, end-point or items changed
+// NOTE: Items field goals are not picked items, bots following it fall back to end-point
+// field on cells where no item is reachable
+void UpdateMazeSwarmGoals(MazeSwarm *swarm, Maze maze, Point endCell, MazeItems items, JobPool *pool)
+{
+    if (swarm->count == 0) return;
+
+    for (int i = 0; i < MAZE_BOT_GOAL_COUNT; i++) UnloadMazeFlowField(swarm->fields[i]);
+
+    swarm->fields[MAZE_BOT_GOAL_END] = LoadMazeFlowField(maze, &endCell, 1, pool);
+
+    Point *goals = (Point *)malloc((items.count + 1)*sizeof(Point));
+    int goalCount = 0;
+
+    if (goals != NULL)
+    {
+        for (int i = 0; i < items.count; i++)
+        {
+            if (!items.picked[i]) goals[goalCount++] = items.cells[i];
+        }
+    }
+
+    swarm->fields[MAZE_BOT_GOAL_ITEM] = LoadMazeFlowField(maze, goals, goalCount, pool);
+
+    free(goals);
+}
+
+// Update swarm bots, in parallel (pool can be NULL)
+// NOTE: Every bot only modifies its own state, so results do not depend on threads count
+void UpdateMazeSwarm(MazeSwarm *swarm, Maze maze, float deltaTime, JobPool *pool)
+{
+    if (swarm->count == 0) return;
+
+    double startTime = GetJobPoolTime();
+
+    int jobCount = (swarm->count + MAZE_SWARM_JOB_BOTS - 1)/MAZE_SWARM_JOB_BOTS;
+    MazeSwarmJobs jobs = { swarm, maze, deltaTime };
+
+    RunJobs(pool, jobCount, UpdateMazeSwarmJob, &jobs);
+
+    for (int i = 0; i < jobCount; i++) swarm->arrivals += swarm->jobArrivals[i];
+
+    swarm->updateTime += GetJobPoolTime() - startTime;
+    swarm->updatedBots += swarm->count;
+}
+
+// Move swarm bots up with scrolled maze rows, bots on evicted rows respawned
+// NOTE: Maze must be already scrolled, bots are respawned on scrolled maze cells
+void ScrollMazeSwarm(MazeSwarm *swarm, Maze maze, int rows)
+{
+    for (int i = 0; i < swarm->count; i++)
+    {
+        swarm->cellsY[i] -= rows;
+
+        if (swarm->cellsY[i] < 0)
+        {
+            SpawnMazeSwarmBot(swarm, maze, i);
+
+            // No walkable cell found, bot kept in maze bounds, respawned again by update
+            if (swarm->cellsY[i] < 0) swarm->cellsY[i] = 0;
+        }
+    }
+}
+
+// Get bot position in cells, cell top-left corner
+Vector2 GetMazeSwarmBotPosition(MazeSwarm swarm, int index)
+{
+    Vector2 position = { (float)swarm.cellsX[index], (float)swarm.cellsY[index] };
+
+    switch (swarm.directions[index])
+    {
+        case MAZE_FLOW_RIGHT: position.x += swarm.progress[index]; break;
+        case MAZE_FLOW_LEFT: position.x -= swarm.progress[index]; break;
+        case MAZE_FLOW_DOWN: position.y += swarm.progress[index]; break;
+        case MAZE_FLOW_UP: position.y -= swarm.progress[index]; break;
+        default: break;
+    }
+
+    return position;
+}
+
+// Get swarm bots state hash (FNV-1a), to check updates are deterministic
+unsigned int GetMazeSwarmHash(MazeSwarm swarm)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; i < swarm.count; i++)
+    {
+        Vector2 position = GetMazeSwarmBotPosition(swarm, i);
+        const unsigned char *bytes = (const unsigned char *)&position;
+
+        for (int b = 0; b < (int)sizeof(Vector2); b++) hash = (hash ^ bytes[b])*16777619u;
+    }
+
+    return hash;
+}
+
+// Get swarm update throughput (bots updated per second)
+double GetMazeSwarmThroughput(MazeSwarm swarm)
+{
+    return (swarm.updateTime > 0.0)? swarm.updatedBots/swarm.updateTime : 0.0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Swarm drawing
+//----------------------------------------------------------------------------------
+// Load swarm drawing batch, meshes uploaded to GPU
+// NOTE: Indices and colors are static, only vertices are updated when drawing
+MazeSwarmBatch LoadMazeSwarmBatch(MazeSwarm swarm)
+{
+    MazeSwarmBatch batch = { 0 };
+
+    if (swarm.count == 0) return batch;
+
+    const Color goalColors[MAZE_BOT_GOAL_COUNT] = { SKYBLUE, ORANGE };
+
+    batch.meshCount = (swarm.count + MAZE_TILES_MAX_QUADS - 1)/MAZE_TILES_MAX_QUADS;
+    batch.meshes = (Mesh *)RL_CALLOC(batch.meshCount, sizeof(Mesh));
+    batch.material = LoadMaterialDefault();
+
+    for (int m = 0; m < batch.meshCount; m++)
+    {
+        Mesh *mesh = &batch.meshes[m];
+        int first = m*MAZE_TILES_MAX_QUADS;
+        int quadCount = ((swarm.count - first) < MAZE_TILES_MAX_QUADS)? (swarm.count - first) : MAZE_TILES_MAX_QUADS;
+
+        mesh->vertexCount = quadCount*4;
+        mesh->triangleCount = quadCount*2;
+        mesh->vertices = (float *)RL_CALLOC(mesh->vertexCount*3, sizeof(float));
+        mesh->texcoords = (float *)RL_CALLOC(mesh->vertexCount*2, sizeof(float));
+        mesh->colors = (unsigned char *)RL_MALLOC(mesh->vertexCount*4);
+        mesh->indices = (unsigned short *)RL_MALLOC(mesh->triangleCount*3*sizeof(unsigned short));
+
+        for (int q = 0; q < quadCount; q++)
+        {
+            Color color = goalColors[swarm.goals[first + q]];
+
+            for (int v = 0; v < 4; v++)
+            {
+                mesh->colors[(q*4 + v)*4] = color.r;
+                mesh->colors[(q*4 + v)*4 + 1] = color.g;
+                mesh->colors[(q*4 + v)*4 + 2] = color.b;
+                mesh->colors[(q*4 + v)*4 + 3] = color.a;
+            }
+
+            // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+            mesh->indices[q*6] = (unsigned short)(q*4);
+            mesh->indices[q*6 + 1] = (unsigned short)(q*4 + 1);
+            mesh->indices[q*6 + 2] = (unsigned short)(q*4 + 2);
+            mesh->indices[q*6 + 3] = (unsigned short)(q*4);
+            mesh->indices[q*6 + 4] = (unsigned short)(q*4 + 2);
+            mesh->indices[q*6 + 5] = (unsigned short)(q*4 + 3);
+        }
+
+        UploadMesh(mesh, true);
+    }
+
+    return batch;
+}
+
+// Unload swarm drawing batch from RAM and VRAM
+void UnloadMazeSwarmBatch(MazeSwarmBatch *batch)
+{
+    for (int m = 0; m < batch->meshCount; m++) UnloadMesh(batch->meshes[m]);
+
+    RL_FREE(batch->meshes);
+    RL_FREE(batch->material.maps);
+
+    *batch = (MazeSwarmBatch){ 0 };
+}
+
+// Draw swarm bots inside BeginMode2D(), quads baked in parallel
+// NOTE: Bots are not culled, all bots vertices are updated every frame
+void DrawMazeSwarm(MazeSwarmBatch *batch, MazeSwarm swarm, Vector2 position, float scale, JobPool *pool)
+{
+    if ((batch->meshCount == 0) || (swarm.count == 0)) return;
+
+    MazeSwarmBatchJobs jobs = { batch, &swarm, position, scale };
+    RunJobs(pool, (swarm.count + MAZE_SWARM_JOB_BOTS - 1)/MAZE_SWARM_JOB_BOTS, GenMazeSwarmVerticesJob, &jobs);
+
+    for (int m = 0; m < batch->meshCount; m++)
+    {
+        Mesh mesh = batch->meshes[m];
+
+        UpdateMeshBuffer(mesh, 0, mesh.vertices, mesh.vertexCount*3*sizeof(float), 0);
+        DrawMesh(mesh, batch->material, MatrixIdentity());
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Generate flow field rows directions, job function
+static void GenMazeFlowRowsJob(void *data, int index)
+{
+    MazeFlowJobs *jobs = (MazeFlowJobs *)data;
+    MazeFlowField *field = jobs->field;
+    const int *distances = jobs->distances.distances;
+    int stride = field->width + 2;
+    int offsets[4] = { 1, -1, stride, -stride };    // MazeFlowDirection order
+
+    int startY = index*MAZE_FLOW_JOB_ROWS;
+    int endY = (startY + MAZE_FLOW_JOB_ROWS < field->height)? startY + MAZE_FLOW_JOB_ROWS : field->height;
+
+    for (int y = startY; y < endY; y++)
+    {
+        const int *row = distances + (y + 1)*stride + 1;
+        unsigned char *directions = field->directions + (size_t)y*field->width;
+
+        for (int x = 0; x < field->width; x++)
+        {
+            int distance = row[x];
+            int direction = MAZE_FLOW_NONE;
+
+            if (distance == 0) direction = MAZE_FLOW_GOAL;
+            else if (distance > 0)
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    if (row[x + offsets[i]] == (distance - 1)) { direction = i; break; }
+                }
+            }
+
+            directions[x] = (unsigned char)direction;
+        }
+    }
+}
+
+// Update swarm bots range, job function
+// NOTE: Bot state is loaded to locals, updated and stored back, arrays are only
+// read and written sequentially by every job
+static void UpdateMazeSwarmJob(void *data, int index)
+{
+    MazeSwarmJobs *jobs = (MazeSwarmJobs *)data;
+    MazeSwarm *swarm = jobs->swarm;
+    Maze maze = jobs->maze;
+    const int stepsX[4] = { 1, -1, 0, 0 };
+    const int stepsY[4] = { 0, 0, 1, -1 };
+
+    int start = index*MAZE_SWARM_JOB_BOTS;
+    int end = (start + MAZE_SWARM_JOB_BOTS < swarm->count)? start + MAZE_SWARM_JOB_BOTS : swarm->count;
+    int arrivals = 0;
+
+    for (int i = start; i < end; i++)
+    {
+        // Bot cell modified into a wall, bot respawned
+        if (!IsMazeCellWalkable(maze, swarm->cellsX[i], swarm->cellsY[i]))
+        {
+            SpawnMazeSwarmBot(swarm, maze, i);
+            continue;
+        }
+
+        int x = swarm->cellsX[i];
+        int y = swarm->cellsY[i];
+        float progress = swarm->progress[i];
+        int direction = swarm->directions[i];
+        float move = swarm->speeds[i]*jobs->deltaTime;
+        bool arrived = false;
+
+        for (int step = 0; (step < MAZE_SWARM_MAX_STEPS) && (move > 0.0f); step++)
+        {
+            // Stopped at cell center, next direction from bot goal flow field
+            if (direction == MAZE_FLOW_NONE)
+            {
+                direction = GetMazeFlowDirection(swarm->fields[swarm->goals[i]], x, y);
+
+                if ((direction == MAZE_FLOW_NONE) && (swarm->goals[i] == MAZE_BOT_GOAL_ITEM)) direction = GetMazeFlowDirection(swarm->fields[MAZE_BOT_GOAL_END], x, y);
+                if (direction == MAZE_FLOW_GOAL) { arrived = true; break; }
+                if (direction == MAZE_FLOW_NONE) break;     // Goal not reachable, bot waits
+            }
+
+            int nextX = x + stepsX[direction];
+            int nextY = y + stepsY[direction];
+
+            // Next cell collision check, bot back to cell center
+            if (!IsMazeCellWalkable(maze, nextX, nextY))
+            {
+                progress = 0.0f;
+                direction = MAZE_FLOW_NONE;
+                break;
+            }
+
+            progress += move;
+
+            if (progress >= 1.0f)
+            {
+                move = progress - 1.0f;
+                progress = 0.0f;
+                direction = MAZE_FLOW_NONE;
+                x = nextX;
+                y = nextY;
+            }
+            else move = 0.0f;
+        }
+
+        swarm->cellsX[i] = x;
+        swarm->cellsY[i] = y;
+        swarm->progress[i] = progress;
+        swarm->directions[i] = (unsigned char)direction;
+
+        if (arrived)
+        {
+            SpawnMazeSwarmBot(swarm, maze, i);
+            arrivals++;
+        }
+    }
+
+    swarm->jobArrivals[index] = arrivals;
+}
+
+// Generate swarm bots range quads vertices, job function
+// NOTE: Jobs ranges never cross meshes, MAZE_SWARM_JOB_BOTS divides MAZE_TILES_MAX_QUADS
+static void GenMazeSwarmVerticesJob(void *data, int index)
+{
+    MazeSwarmBatchJobs *jobs = (MazeSwarmBatchJobs *)data;
+    const MazeSwarm *swarm = jobs->swarm;
+    float size = jobs->scale*MAZE_SWARM_BOT_SIZE;
+    float offset = (jobs->scale - size)*0.5f;
+
+    int start = index*MAZE_SWARM_JOB_BOTS;
+    int end = (start + MAZE_SWARM_JOB_BOTS < swarm->count)? start + MAZE_SWARM_JOB_BOTS : swarm->count;
+
+    float *vertices = jobs->batch->meshes[start/MAZE_TILES_MAX_QUADS].vertices + (start%MAZE_TILES_MAX_QUADS)*12;
+
+    for (int i = start; i < end; i++)
+    {
+        Vector2 cell = GetMazeSwarmBotPosition(*swarm, i);
+        float left = jobs->position.x + cell.x*jobs->scale + offset;
+        float top = jobs->position.y + cell.y*jobs->scale + offset;
+        float right = left + size;
+        float bottom = top + size;
+
+        vertices[0] = left;  vertices[1] = top;    vertices[2] = 0.0f;
+        vertices[3] = left;  vertices[4] = bottom; vertices[5] = 0.0f;
+        vertices[6] = right; vertices[7] = bottom; vertices[8] = 0.0f;
+        vertices[9] = right; vertices[10] = top;   vertices[11] = 0.0f;
+        vertices += 12;
+    }
+}
+
+// Get next bot random value (xorshift32)
+static unsigned int GetBotRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+// Spawn bot at a random walkable cell, bot kept at its cell if none found
+static void SpawnMazeSwarmBot(MazeSwarm *swarm, Maze maze, int index)
+{
+    swarm->progress[index] = 0.0f;
+    swarm->directions[index] = MAZE_FLOW_NONE;
+
+    for (int i = 0; i < MAZE_SWARM_SPAWN_TRIES; i++)
+    {
+        int x = (int)(GetBotRandom(&swarm->randoms[index])%(unsigned int)maze.width);
+        int y = (int)(GetBotRandom(&swarm->randoms[index])%(unsigned int)maze.height);
+
+        if (IsMazeCellWalkable(maze, x, y))
+        {
+            swarm->cellsX[index] = x;
+            swarm->cellsY[index] = y;
+            break;
+        }
+    }
+}
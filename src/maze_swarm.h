@@ -0,0 +1,126 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze bots swarm module
+*
+*   Thousands of bot agents navigating the maze, for simulation stress tests: every bot
+*   steers towards end-point or nearest not picked item, following a flow field shared by
+*   all bots with the same goal, computed once per goal from a distance field (BFS)
+*
+*   Bots state is stored as structure of arrays, bots only read maze cells and flow fields,
+*   so they are updated in parallel by ranges on a job pool; bots move between cell centers,
+*   next cell is checked against maze grid before moving (flow fields are not updated while
+*   maze is edited), bots reaching their goal are respawned at a random walkable cell
+*
+*   NOTE: Bots do not pick items or collide between them, game items are never modified
+*
+*   Swarm drawing: bots quads are baked in parallel into dynamic meshes, updated once per
+*   frame, one mesh (one draw call) up to MAZE_TILES_MAX_QUADS bots
+*
+*   NOTE: Swarm update only uses raylib CPU-side functionality, it does not require a
+*   window initialized; swarm batch functions require a window (GPU buffers)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_SWARM_H
+#define MAZE_SWARM_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze, Point
+#include "maze_items.h"     // Required for: MazeItems
+#include "job_pool.h"       // Required for: JobPool
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAZE_SWARM_JOB_BOTS         2048    // Bots updated per job, divides MAZE_TILES_MAX_QUADS
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Flow field directions, next step from a cell towards goal
+// NOTE: Directions order matches GetMazeDistanceStep() neighbors order
+typedef enum {
+    MAZE_FLOW_RIGHT = 0,
+    MAZE_FLOW_LEFT,
+    MAZE_FLOW_DOWN,
+    MAZE_FLOW_UP,
+    MAZE_FLOW_GOAL,             // Goal cell
+    MAZE_FLOW_NONE              // Wall cell or goal not reachable
+} MazeFlowDirection;
+
+// Bot goals, every goal has its own flow field
+typedef enum {
+    MAZE_BOT_GOAL_END = 0,      // End-point cell
+    MAZE_BOT_GOAL_ITEM,         // Nearest not picked item, end-point if no item reachable
+    MAZE_BOT_GOAL_COUNT
+} MazeBotGoal;
+
+// Maze flow field, next step direction from every cell towards goal
+typedef struct MazeFlowField {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    unsigned char *directions;  // Cells direction (MazeFlowDirection), row-major
+} MazeFlowField;
+
+// Maze bots swarm, bots state stored as structure of arrays
+// NOTE: Bot position is cell + direction*progress, in cells
+typedef struct MazeSwarm {
+    int count;                  // Bots count
+    int *cellsX;                // Bots cell (last reached cell center)
+    int *cellsY;
+    float *progress;            // Bots move progress towards next cell [0.0f..1.0f)
+    float *speeds;              // Bots speed in cells per second
+    unsigned char *directions;  // Bots move direction (MazeFlowDirection), MAZE_FLOW_NONE if stopped at cell
+    unsigned char *goals;       // Bots goal (MazeBotGoal)
+    unsigned int *randoms;      // Bots random generator state, bots respawn is deterministic on any thread
+
+    MazeFlowField fields[MAZE_BOT_GOAL_COUNT]; // Flow field for every goal
+    int *jobArrivals;           // Goal arrivals per update job, added after update
+    unsigned int arrivals;      // Goal arrivals count (bots respawned)
+
+    double updateTime;          // Accumulated update time in seconds, for throughput
+    double updatedBots;         // Accumulated updated bots count, for throughput
+} MazeSwarm;
+
+// Maze swarm drawing batch, dynamic meshes for swarm bots quads
+typedef struct MazeSwarmBatch {
+    int meshCount;              // Meshes count, MAZE_TILES_MAX_QUADS bots per mesh
+    Mesh *meshes;               // Bots quads meshes, vertex colors by bot goal
+    Material material;          // Default material, default white texture
+} MazeSwarmBatch;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Flow field functions
+MazeFlowField LoadMazeFlowField(Maze maze, const Point *goals, int goalCount, JobPool *pool); // Load flow field to nearest goal cell (pool can be NULL)
+void UnloadMazeFlowField(MazeFlowField field);              // Unload flow field from memory
+int GetMazeFlowDirection(MazeFlowField field, int x, int y); // Get cell flow direction (MazeFlowDirection), MAZE_FLOW_NONE out of bounds
+
+// Swarm functions
+MazeSwarm LoadMazeSwarm(Maze maze, Point endCell, MazeItems items, int count, unsigned int seed, JobPool *pool); // Load swarm, bots spawned at random walkable cells
+void UnloadMazeSwarm(MazeSwarm *swarm);                     // Unload swarm from memory
+void UpdateMazeSwarmGoals(MazeSwarm *swarm, Maze maze, Point endCell, MazeItems items, JobPool *pool); // Update swarm flow fields, required if maze cells, end-point or items changed
+void UpdateMazeSwarm(MazeSwarm *swarm, Maze maze, float deltaTime, JobPool *pool); // Update swarm bots, in parallel (pool can be NULL)
+void ScrollMazeSwarm(MazeSwarm *swarm, Maze maze, int rows); // Move swarm bots up with scrolled maze rows, bots on evicted rows respawned
+Vector2 GetMazeSwarmBotPosition(MazeSwarm swarm, int index); // Get bot position in cells, cell top-left corner
+unsigned int GetMazeSwarmHash(MazeSwarm swarm);             // Get swarm bots state hash (FNV-1a), to check updates are deterministic
+double GetMazeSwarmThroughput(MazeSwarm swarm);             // Get swarm update throughput (bots updated per second)
+
+// Swarm drawing functions
+MazeSwarmBatch LoadMazeSwarmBatch(MazeSwarm swarm);         // Load swarm drawing batch, meshes uploaded to GPU
+void UnloadMazeSwarmBatch(MazeSwarmBatch *batch);           // Unload swarm drawing batch from RAM and VRAM
+void DrawMazeSwarm(MazeSwarmBatch *batch, MazeSwarm swarm, Vector2 position, float scale, JobPool *pool); // Draw swarm bots inside BeginMode2D(), quads baked in parallel
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_SWARM_H
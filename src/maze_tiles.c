@@ -0,0 +1,118 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze tiles batch builder
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_tiles.h"
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get normalized atlas rectangle (texcoords) for a maze cell type
+Rectangle GetMazeTileAtlasRec(int cell)
+{
+    Rectangle rec = { 0.0f, 0.0f, 0.5f, 0.5f };
+
+    switch (cell)
+    {
+        case MAZE_CELL_WALL: break;
+        case MAZE_CELL_ITEM: rec.y = 0.5f; break;
+        case MAZE_CELL_END: rec.x = 0.5f; rec.y = 0.5f; break;
+        default: rec.x = 0.5f; break;   // MAZE_CELL_FLOOR
+    }
+
+    return rec;
+}
+
+// Generate tiles mesh for a maze cells region, one quad per cell
+// NOTE: Region is clipped to maze bounds and limited to MAZE_TILES_MAX_QUADS cells,
+// quads are placed at position + cell*scale, ready to be drawn in 2d mode
+Mesh GenMeshMazeTiles(Maze maze, Rectangle cells, Vector2 position, float scale)
+{
+    Mesh mesh = { 0 };
+
+    int startX = (cells.x < 0)? 0 : (int)cells.x;
+    int startY = (cells.y < 0)? 0 : (int)cells.y;
+    int endX = (int)(cells.x + cells.width);
+    int endY = (int)(cells.y + cells.height);
+    if (endX > maze.width) endX = maze.width;
+    if (endY > maze.height) endY = maze.height;
+
+    if ((endX <= startX) || (endY <= startY)) return mesh;
+    if ((endX - startX)*(endY - startY) > MAZE_TILES_MAX_QUADS)
+    {
+        TraceLog(LOG_WARNING, "MAZE: Tiles region too big (%ix%i), max quads: %i", endX - startX, endY - startY, MAZE_TILES_MAX_QUADS);
+        return mesh;
+    }
+
+    int quadCount = (endX - startX)*(endY - startY);
+
+    mesh.vertexCount = quadCount*4;
+    mesh.triangleCount = quadCount*2;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+    // Atlas rectangles lookup, avoid computing them per cell
+    Rectangle atlasRecs[4] = { 0 };
+    for (int i = 0; i < 4; i++) atlasRecs[i] = GetMazeTileAtlasRec(i);
+
+    float *vertices = mesh.vertices;
+    float *texcoords = mesh.texcoords;
+    unsigned short *indices = mesh.indices;
+    int vertexIndex = 0;
+
+    for (int y = startY; y < endY; y++)
+    {
+        float top = position.y + y*scale;
+        float bottom = top + scale;
+
+        for (int x = startX; x < endX; x++)
+        {
+            Rectangle uv = atlasRecs[GetMazeCell(maze, x, y) & 3];
+            float left = position.x + x*scale;
+            float right = left + scale;
+
+            // Quad vertex order: top-left, bottom-left, bottom-right, top-right
+            // NOTE: Same winding used by raylib 2d shapes, required by backface culling
+            vertices[0] = left;  vertices[1] = top;    vertices[2] = 0.0f;
+            vertices[3] = left;  vertices[4] = bottom; vertices[5] = 0.0f;
+            vertices[6] = right; vertices[7] = bottom; vertices[8] = 0.0f;
+            vertices[9] = right; vertices[10] = top;   vertices[11] = 0.0f;
+            vertices += 12;
+
+            texcoords[0] = uv.x;            texcoords[1] = uv.y;
+            texcoords[2] = uv.x;            texcoords[3] = uv.y + uv.height;
+            texcoords[4] = uv.x + uv.width; texcoords[5] = uv.y + uv.height;
+            texcoords[6] = uv.x + uv.width; texcoords[7] = uv.y;
+            texcoords += 8;
+
+            indices[0] = (unsigned short)(vertexIndex);
+            indices[1] = (unsigned short)(vertexIndex + 1);
+            indices[2] = (unsigned short)(vertexIndex + 2);
+            indices[3] = (unsigned short)(vertexIndex);
+            indices[4] = (unsigned short)(vertexIndex + 2);
+            indices[5] = (unsigned short)(vertexIndex + 3);
+            indices += 6;
+
+            vertexIndex += 4;
+        }
+    }
+
+    return mesh;
+}
+
+// Unload mesh CPU data only, for meshes never uploaded to GPU
+// NOTE: Use UnloadMesh() for meshes uploaded with UploadMesh()
+void UnloadMeshData(Mesh mesh)
+{
+    RL_FREE(mesh.vertices);
+    RL_FREE(mesh.texcoords);
+    RL_FREE(mesh.texcoords2);
+    RL_FREE(mesh.normals);
+    RL_FREE(mesh.colors);
+    RL_FREE(mesh.indices);
+}
@@ -0,0 +1,47 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze tiles batch builder
+*
+*   Bakes maze cells into a static quad batch (raylib Mesh), one textured quad per cell,
+*   using the biome texture as a 2x2 tiles atlas:
+*
+*       +-------+-------+
+*       | Wall  | Floor |
+*       +-------+-------+
+*       | Item  |  End  |
+*       +-------+-------+
+*
+*   NOTE: Mesh data is generated on CPU only, no GPU upload is done by this module, so it
+*   can be used without a window initialized; upload it with UploadMesh() for drawing
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_TILES_H
+#define MAZE_TILES_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze
+
+// Maximum number of quads in a single tiles mesh
+// NOTE: Mesh indices are 16bit, so a mesh can address up to 65536 vertex (4 per quad)
+#define MAZE_TILES_MAX_QUADS        16384
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+Rectangle GetMazeTileAtlasRec(int cell);        // Get normalized atlas rectangle (texcoords) for a maze cell type
+Mesh GenMeshMazeTiles(Maze maze, Rectangle cells, Vector2 position, float scale); // Generate tiles mesh for a maze cells region, one quad per cell
+void UnloadMeshData(Mesh mesh);                 // Unload mesh CPU data only, for meshes never uploaded to GPU
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_TILES_H
@@ -0,0 +1,301 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze view module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_view.h"
+
+#include "raymath.h"        // Required for: MatrixIdentity()
+
+#include "maze_tiles.h"     // Required for: GenMeshMazeTiles()
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <math.h>           // Required for: floorf(), ceilf()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int GetMazeViewSlot(MazeView *view, int chunkIndex);        // Get pool slot for a chunk, recycling least recently used one if required
+static void UnloadMazeViewSlot(MazeView *view, int slot);           // Unload pool slot GPU resources
+static void GetMazeViewChunkRange(MazeView view, Maze maze, Camera2D camera, Point *start, Point *end); // Get visible chunks range (inclusive)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze view, no chunk is loaded until drawn
+MazeView LoadMazeView(Maze maze, Vector2 position, float scale)
+{
+    MazeView view = { 0 };
+
+    view.position = position;
+    view.scale = scale;
+    view.chunksX = maze.chunksX;
+    view.chunksY = maze.chunksY;
+    view.chunkSlots = (int *)malloc(maze.chunksX*maze.chunksY*sizeof(int));
+    view.slots = (MazeViewChunk *)calloc(MAZE_VIEW_MAX_CHUNKS, sizeof(MazeViewChunk));
+    view.material = LoadMaterialDefault();
+
+    for (int i = 0; i < maze.chunksX*maze.chunksY; i++) view.chunkSlots[i] = -1;
+    for (int i = 0; i < MAZE_VIEW_MAX_CHUNKS; i++) view.slots[i].index = -1;
+
+    return view;
+}
+
+// Unload maze view and all loaded chunks
+void UnloadMazeView(MazeView *view)
+{
+    for (int i = 0; i < MAZE_VIEW_MAX_CHUNKS; i++) UnloadMazeViewSlot(view, i);
+
+    free(view->chunkSlots);
+    free(view->slots);
+
+    // NOTE: Material diffuse texture is the atlas provided on drawing, not owned by the view
+    RL_FREE(view->material.maps);
+
+    *view = (MazeView){ 0 };
+}
+
+// Get maze cells region visible by camera (not clipped)
+Rectangle GetMazeViewVisibleCells(MazeView view, Camera2D camera, int screenWidth, int screenHeight)
+{
+    // View rectangle in world coordinates, considering camera zoom
+    Vector2 worldMin = {
+        camera.target.x - camera.offset.x/camera.zoom,
+        camera.target.y - camera.offset.y/camera.zoom
+    };
+    Vector2 worldMax = {
+        worldMin.x + screenWidth/camera.zoom,
+        worldMin.y + screenHeight/camera.zoom
+    };
+
+    Rectangle cells = { 0 };
+    cells.x = floorf((worldMin.x - view.position.x)/view.scale);
+    cells.y = floorf((worldMin.y - view.position.y)/view.scale);
+    cells.width = ceilf((worldMax.x - view.position.x)/view.scale) - cells.x;
+    cells.height = ceilf((worldMax.y - view.position.y)/view.scale) - cells.y;
+
+    return cells;
+}
+
+// Get maze cell at world position
+Point GetMazeViewCell(MazeView view, Vector2 position)
+{
+    Point cell = {
+        (int)floorf((position.x - view.position.x)/view.scale),
+        (int)floorf((position.y - view.position.y)/view.scale)
+    };
+
+    return cell;
+}
+
+// Update loaded chunks for a modified maze cells region
+// NOTE: Editor textures are updated immediately (only the modified sub-rectangle),
+// tiles meshes are regenerated when drawn, upload time is accumulated in view uploadTime
+void UpdateMazeViewCells(MazeView *view, Maze maze, Rectangle cells)
+{
+    int startX = (cells.x < 0)? 0 : (int)cells.x;
+    int startY = (cells.y < 0)? 0 : (int)cells.y;
+    int endX = (int)(cells.x + cells.width);
+    int endY = (int)(cells.y + cells.height);
+    if (endX > maze.width) endX = maze.width;
+    if (endY > maze.height) endY = maze.height;
+
+    if ((endX <= startX) || (endY <= startY)) return;
+
+    Color pixels[MAZE_CHUNK_CELLS] = { 0 };
+
+    for (int cy = (startY >> MAZE_CHUNK_SHIFT); cy <= ((endY - 1) >> MAZE_CHUNK_SHIFT); cy++)
+    {
+        for (int cx = (startX >> MAZE_CHUNK_SHIFT); cx <= ((endX - 1) >> MAZE_CHUNK_SHIFT); cx++)
+        {
+            int slot = view->chunkSlots[cy*view->chunksX + cx];
+
+            if (slot < 0) continue;     // Chunk not loaded, it will be generated when visible
+
+            MazeViewChunk *chunk = &view->slots[slot];
+
+            if (chunk->tiles.vertexCount > 0) chunk->tilesDirty = true;
+
+            if (chunk->texture.id > 0)
+            {
+                // Modified region inside chunk, in chunk local coordinates
+                int localStartX = ((startX > cx*MAZE_CHUNK_SIZE)? startX : cx*MAZE_CHUNK_SIZE) - cx*MAZE_CHUNK_SIZE;
+                int localStartY = ((startY > cy*MAZE_CHUNK_SIZE)? startY : cy*MAZE_CHUNK_SIZE) - cy*MAZE_CHUNK_SIZE;
+                int localEndX = ((endX < (cx + 1)*MAZE_CHUNK_SIZE)? endX : (cx + 1)*MAZE_CHUNK_SIZE) - cx*MAZE_CHUNK_SIZE;
+                int localEndY = ((endY < (cy + 1)*MAZE_CHUNK_SIZE)? endY : (cy + 1)*MAZE_CHUNK_SIZE) - cy*MAZE_CHUNK_SIZE;
+                int width = localEndX - localStartX;
+                const unsigned char *chunkCells = GetMazeChunk(maze, cx, cy);
+
+                for (int y = localStartY; y < localEndY; y++)
+                {
+                    GetMazeColorsFromCells(chunkCells + y*MAZE_CHUNK_SIZE + localStartX, pixels + (y - localStartY)*width, width);
+                }
+
+                double uploadStartTime = GetTime();
+                UpdateTextureRec(chunk->texture, (Rectangle){ (float)localStartX, (float)localStartY, (float)width, (float)(localEndY - localStartY) }, pixels);
+                view->uploadTime += GetTime() - uploadStartTime;
+                view->uploadCount++;
+            }
+        }
+    }
+}
+
+// Draw visible maze tiles meshes (game mode), inside BeginMode2D()
+// NOTE: One draw call per visible chunk, meshes are generated the first time a chunk is visible
+void DrawMazeViewTiles(MazeView *view, Maze maze, Camera2D camera, Texture atlas)
+{
+    Point start = { 0 };
+    Point end = { 0 };
+    GetMazeViewChunkRange(*view, maze, camera, &start, &end);
+
+    view->frameCounter++;
+    view->material.maps[MATERIAL_MAP_DIFFUSE].texture = atlas;
+
+    for (int cy = start.y; cy <= end.y; cy++)
+    {
+        for (int cx = start.x; cx <= end.x; cx++)
+        {
+            int slot = GetMazeViewSlot(view, cy*view->chunksX + cx);
+
+            if (slot < 0) continue;     // Pool exhausted, too many visible chunks
+
+            MazeViewChunk *chunk = &view->slots[slot];
+
+            if ((chunk->tiles.vertexCount == 0) || chunk->tilesDirty)
+            {
+                double uploadStartTime = GetTime();
+
+                if (chunk->tiles.vertexCount > 0) UnloadMesh(chunk->tiles);
+
+                chunk->tiles = GenMeshMazeTiles(maze, (Rectangle){ (float)(cx*MAZE_CHUNK_SIZE), (float)(cy*MAZE_CHUNK_SIZE),
+                    MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE }, view->position, view->scale);
+                UploadMesh(&chunk->tiles, false);
+                chunk->tilesDirty = false;
+
+                view->uploadTime += GetTime() - uploadStartTime;
+                view->uploadCount++;
+            }
+
+            DrawMesh(chunk->tiles, view->material, MatrixIdentity());
+        }
+    }
+}
+
+// Draw visible maze cells textures (editor mode), inside BeginMode2D()
+// NOTE: One texture per visible chunk, one pixel per cell, scaled to view scale
+void DrawMazeViewCells(MazeView *view, Maze maze, Camera2D camera)
+{
+    Point start = { 0 };
+    Point end = { 0 };
+    GetMazeViewChunkRange(*view, maze, camera, &start, &end);
+
+    view->frameCounter++;
+
+    for (int cy = start.y; cy <= end.y; cy++)
+    {
+        for (int cx = start.x; cx <= end.x; cx++)
+        {
+            int slot = GetMazeViewSlot(view, cy*view->chunksX + cx);
+
+            if (slot < 0) continue;     // Pool exhausted, too many visible chunks
+
+            MazeViewChunk *chunk = &view->slots[slot];
+
+            if (chunk->texture.id == 0)
+            {
+                double uploadStartTime = GetTime();
+                const unsigned char *chunkCells = GetMazeChunk(maze, cx, cy);
+                Color *pixels = (Color *)RL_MALLOC(MAZE_CHUNK_CELLS*sizeof(Color));
+
+                GetMazeColorsFromCells(chunkCells, pixels, MAZE_CHUNK_CELLS);
+
+                Image image = { pixels, MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                chunk->texture = LoadTextureFromImage(image);
+                UnloadImage(image);
+
+                view->uploadTime += GetTime() - uploadStartTime;
+                view->uploadCount++;
+            }
+
+            // Only cells inside maze bounds are drawn for last row/column chunks
+            int width = ((cx + 1)*MAZE_CHUNK_SIZE > maze.width)? maze.width - cx*MAZE_CHUNK_SIZE : MAZE_CHUNK_SIZE;
+            int height = ((cy + 1)*MAZE_CHUNK_SIZE > maze.height)? maze.height - cy*MAZE_CHUNK_SIZE : MAZE_CHUNK_SIZE;
+
+            DrawTexturePro(chunk->texture, (Rectangle){ 0, 0, (float)width, (float)height },
+                (Rectangle){ view->position.x + cx*MAZE_CHUNK_SIZE*view->scale, view->position.y + cy*MAZE_CHUNK_SIZE*view->scale,
+                    width*view->scale, height*view->scale }, (Vector2){ 0 }, 0.0f, WHITE);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get pool slot for a chunk, recycling least recently used one if required
+// NOTE: Chunks drawn in current frame are never recycled, -1 is returned if no slot available
+static int GetMazeViewSlot(MazeView *view, int chunkIndex)
+{
+    int slot = view->chunkSlots[chunkIndex];
+
+    if (slot < 0)
+    {
+        for (int i = 0; i < MAZE_VIEW_MAX_CHUNKS; i++)
+        {
+            if (view->slots[i].index == -1) { slot = i; break; }
+            if ((view->slots[i].lastFrame != view->frameCounter) &&
+                ((slot < 0) || (view->slots[i].lastFrame < view->slots[slot].lastFrame))) slot = i;
+        }
+
+        if (slot < 0) return -1;
+
+        UnloadMazeViewSlot(view, slot);
+
+        view->slots[slot].index = chunkIndex;
+        view->chunkSlots[chunkIndex] = slot;
+    }
+
+    view->slots[slot].lastFrame = view->frameCounter;
+
+    return slot;
+}
+
+// Unload pool slot GPU resources
+static void UnloadMazeViewSlot(MazeView *view, int slot)
+{
+    MazeViewChunk *chunk = &view->slots[slot];
+
+    if (chunk->index == -1) return;
+
+    if (chunk->tiles.vertexCount > 0) UnloadMesh(chunk->tiles);
+    if (chunk->texture.id > 0) UnloadTexture(chunk->texture);
+
+    view->chunkSlots[chunk->index] = -1;
+    *chunk = (MazeViewChunk){ 0 };
+    chunk->index = -1;
+}
+
+// Get visible chunks range (inclusive)
+// NOTE: Screen size is the current render size, range is clipped to maze chunks
+static void GetMazeViewChunkRange(MazeView view, Maze maze, Camera2D camera, Point *start, Point *end)
+{
+    Rectangle cells = GetMazeViewVisibleCells(view, camera, GetScreenWidth(), GetScreenHeight());
+
+    int startX = (int)cells.x;
+    int startY = (int)cells.y;
+    int endX = (int)(cells.x + cells.width) - 1;
+    int endY = (int)(cells.y + cells.height) - 1;
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX >= maze.width) endX = maze.width - 1;
+    if (endY >= maze.height) endY = maze.height - 1;
+
+    // NOTE: An empty range is returned as start > end
+    start->x = startX >> MAZE_CHUNK_SHIFT;
+    start->y = startY >> MAZE_CHUNK_SHIFT;
+    end->x = (endX < startX)? start->x - 1 : (endX >> MAZE_CHUNK_SHIFT);
+    end->y = (endY < startY)? start->y - 1 : (endY >> MAZE_CHUNK_SHIFT);
+}
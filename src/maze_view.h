@@ -0,0 +1,74 @@
+/*******************************************************************************************
+*
+*   raylib maze game - maze view module
+*
+*   Draws maze chunks intersecting the Camera2D view rectangle, GPU resources for every
+*   chunk (game mode tiles mesh, editor mode cells texture) are only loaded for visible
+*   chunks, kept in a fixed-size pool and recycled least-recently-used first, so frame
+*   cost depends on screen size and camera zoom, not on maze size
+*
+*   NOTE: Camera2D rotation is not considered to compute the view rectangle
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_VIEW_H
+#define MAZE_VIEW_H
+
+#include "raylib.h"
+
+#include "maze.h"           // Required for: Maze
+
+// Maximum number of chunks with GPU resources loaded at the same time
+// NOTE: Cameras zoom must be limited to keep visible chunks under this limit
+#define MAZE_VIEW_MAX_CHUNKS        128
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze view chunk, GPU resources for one maze chunk
+typedef struct MazeViewChunk {
+    int index;                  // Maze chunk index (chunkY*chunksX + chunkX), -1 if unused
+    Mesh tiles;                 // Game mode tiles mesh, vertexCount is 0 if not loaded
+    Texture texture;            // Editor mode cells texture (one pixel per cell), id is 0 if not loaded
+    bool tilesDirty;            // Tiles mesh must be regenerated before drawing
+    unsigned int lastFrame;     // Last frame the chunk was drawn
+} MazeViewChunk;
+
+// Maze view, drawing state for a maze
+typedef struct MazeView {
+    Vector2 position;           // Maze drawing position (world coordinates)
+    float scale;                // Maze cell size (world units)
+    int chunksX;                // Maze chunks per row
+    int chunksY;                // Maze chunks per column
+    int *chunkSlots;            // Pool slot for every maze chunk, -1 if not loaded
+    MazeViewChunk *slots;       // Loaded chunks pool (MAZE_VIEW_MAX_CHUNKS)
+    unsigned int frameCounter;  // Drawn frames counter, for chunks recycling
+    Material material;          // Tiles material, diffuse texture set on drawing
+    double uploadTime;          // Chunks GPU upload time accumulated (seconds), reset by user
+    int uploadCount;            // Chunks GPU uploads accumulated, reset by user
+} MazeView;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeView LoadMazeView(Maze maze, Vector2 position, float scale);    // Load maze view, no chunk is loaded until drawn
+void UnloadMazeView(MazeView *view);                                // Unload maze view and all loaded chunks
+
+Rectangle GetMazeViewVisibleCells(MazeView view, Camera2D camera, int screenWidth, int screenHeight); // Get maze cells region visible by camera (not clipped)
+Point GetMazeViewCell(MazeView view, Vector2 position);             // Get maze cell at world position
+void UpdateMazeViewCells(MazeView *view, Maze maze, Rectangle cells); // Update loaded chunks for a modified maze cells region
+
+void DrawMazeViewTiles(MazeView *view, Maze maze, Camera2D camera, Texture atlas); // Draw visible maze tiles meshes (game mode), inside BeginMode2D()
+void DrawMazeViewCells(MazeView *view, Maze maze, Camera2D camera); // Draw visible maze cells textures (editor mode), inside BeginMode2D()
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_VIEW_H
@@ -0,0 +1,181 @@
+/*******************************************************************************************
+*
+*   raylib maze game - resource pack module
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "resource_pack.h"
+
+#include <stdio.h>      // Required for: FILE, fopen(), fwrite(), fclose()
+#include <string.h>     // Required for: memcmp(), memcpy(), strncpy(), strcmp(), strlen()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RESOURCE_PACK_ALIGNMENT     16      // Files data alignment in bytes
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load resource pack, whole file read at once
+// NOTE: Header and entries table are validated, an invalid pack is unloaded
+ResourcePack LoadResourcePack(const char *fileName)
+{
+    ResourcePack pack = { 0 };
+
+    if (!FileExists(fileName)) return pack;
+
+    pack.data = LoadFileData(fileName, &pack.dataSize);
+
+    if (pack.data == NULL) return pack;
+
+    const ResourcePackHeader *header = (const ResourcePackHeader *)pack.data;
+    bool valid = (pack.dataSize >= (int)sizeof(ResourcePackHeader)) && (memcmp(header->id, "RPAK", 4) == 0);
+
+    if (valid)
+    {
+        // Check all entries are inside file, using 64bit sizes to avoid overflows
+        unsigned long long tableEnd = header->headerSize + (unsigned long long)header->entryCount*sizeof(ResourcePackEntry);
+
+        valid = (header->version <= RESOURCE_PACK_VERSION) && (header->headerSize >= sizeof(ResourcePackHeader)) &&
+            ((header->headerSize%4) == 0) && (header->dataSize == (unsigned int)pack.dataSize) && (tableEnd <= (unsigned long long)pack.dataSize);
+
+        if (valid)
+        {
+            pack.entries = (const ResourcePackEntry *)(pack.data + header->headerSize);
+
+            for (unsigned int i = 0; i < header->entryCount; i++)
+            {
+                const ResourcePackEntry *entry = &pack.entries[i];
+
+                if ((entry->name[RESOURCE_PACK_NAME_SIZE - 1] != '\0') || (entry->offset < tableEnd) ||
+                    (((unsigned long long)entry->offset + entry->size) > (unsigned long long)pack.dataSize)) { valid = false; break; }
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "RPAK: [%s] Resource pack not valid", fileName);
+        UnloadFileData(pack.data);
+        return (ResourcePack){ 0 };
+    }
+
+    pack.header = header;
+
+    TraceLog(LOG_INFO, "RPAK: [%s] Resource pack loaded successfully (%u files, %i bytes)", fileName, header->entryCount, pack.dataSize);
+
+    return pack;
+}
+
+// Unload resource pack data
+void UnloadResourcePack(ResourcePack pack)
+{
+    UnloadFileData(pack.data);
+}
+
+// Check if resource pack is valid (loaded and entries consistent)
+bool IsResourcePackValid(ResourcePack pack)
+{
+    return (pack.header != NULL);
+}
+
+// Get packed file data by name, NULL if not found
+// NOTE: Returned data references pack data, it must not be freed
+const unsigned char *GetResourcePackFile(ResourcePack pack, const char *name, int *dataSize)
+{
+    if (pack.header == NULL) return NULL;
+
+    for (unsigned int i = 0; i < pack.header->entryCount; i++)
+    {
+        if (strcmp(pack.entries[i].name, name) == 0)
+        {
+            if (dataSize != NULL) *dataSize = (int)pack.entries[i].size;
+            return pack.data + pack.entries[i].offset;
+        }
+    }
+
+    return NULL;
+}
+
+// Export files to resource pack, entries named by file name (without path)
+bool ExportResourcePack(const char **fileNames, int fileCount, const char *fileName)
+{
+    if (fileCount <= 0) return false;
+
+    ResourcePackEntry *entries = (ResourcePackEntry *)RL_CALLOC(fileCount, sizeof(ResourcePackEntry));
+    unsigned char **filesData = (unsigned char **)RL_CALLOC(fileCount, sizeof(unsigned char *));
+    bool success = (entries != NULL) && (filesData != NULL);
+
+    // STEP 1: Load all files and set entries table, files data aligned after table
+    unsigned long long offset = sizeof(ResourcePackHeader) + (unsigned long long)fileCount*sizeof(ResourcePackEntry);
+
+    for (int i = 0; (i < fileCount) && success; i++)
+    {
+        const char *name = GetFileName(fileNames[i]);
+        int dataSize = 0;
+
+        if (strlen(name) >= RESOURCE_PACK_NAME_SIZE)
+        {
+            TraceLog(LOG_WARNING, "RPAK: [%s] File name too long to be packed", fileNames[i]);
+            success = false;
+            break;
+        }
+
+        filesData[i] = LoadFileData(fileNames[i], &dataSize);
+        success = (filesData[i] != NULL) || (dataSize == 0);
+
+        offset = (offset + RESOURCE_PACK_ALIGNMENT - 1)/RESOURCE_PACK_ALIGNMENT*RESOURCE_PACK_ALIGNMENT;
+
+        strncpy(entries[i].name, name, RESOURCE_PACK_NAME_SIZE - 1);
+        entries[i].offset = (unsigned int)offset;
+        entries[i].size = (unsigned int)dataSize;
+
+        offset += dataSize;
+    }
+
+    if (offset > 0xffffffffULL) success = false;
+
+    FILE *file = success? fopen(fileName, "wb") : NULL;
+
+    if (file != NULL)
+    {
+        // STEP 2: Write header, entries table and files data
+        ResourcePackHeader header = { 0 };
+        memcpy(header.id, "RPAK", 4);
+        header.version = RESOURCE_PACK_VERSION;
+        header.headerSize = sizeof(ResourcePackHeader);
+        header.entryCount = (unsigned int)fileCount;
+        header.dataSize = (unsigned int)offset;
+
+        unsigned char padding[RESOURCE_PACK_ALIGNMENT] = { 0 };
+        unsigned long long position = sizeof(ResourcePackHeader) + (unsigned long long)fileCount*sizeof(ResourcePackEntry);
+
+        success = (fwrite(&header, sizeof(ResourcePackHeader), 1, file) == 1) &&
+            (fwrite(entries, sizeof(ResourcePackEntry), fileCount, file) == (size_t)fileCount);
+
+        for (int i = 0; (i < fileCount) && success; i++)
+        {
+            size_t paddingSize = (size_t)(entries[i].offset - position);
+
+            success = (fwrite(padding, 1, paddingSize, file) == paddingSize) &&
+                (fwrite(filesData[i], 1, entries[i].size, file) == entries[i].size);
+
+            position = entries[i].offset + entries[i].size;
+        }
+
+        success = (fclose(file) == 0) && success;
+    }
+    else success = false;
+
+    if (success) TraceLog(LOG_INFO, "RPAK: [%s] Resource pack saved successfully (%i files, %u bytes)", fileName, fileCount, (unsigned int)offset);
+    else TraceLog(LOG_WARNING, "RPAK: [%s] Failed to save resource pack", fileName);
+
+    for (int i = 0; (filesData != NULL) && (i < fileCount); i++) UnloadFileData(filesData[i]);
+    RL_FREE(filesData);
+    RL_FREE(entries);
+
+    return success;
+}
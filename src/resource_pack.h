@@ -0,0 +1,78 @@
+/*******************************************************************************************
+*
+*   raylib maze game - resource pack module
+*
+*   Packed resources archive (.rpak), several resource files stored in a single file,
+*   so all resources are loaded with one sequential read instead of many small file opens:
+*
+*       Offset  Size                Data
+*       0       16                  Header (ResourcePackHeader)
+*       16      entryCount*64       Entries table (ResourcePackEntry)
+*       ...     ...                 Files data, every file aligned to 16 bytes
+*
+*   Files are stored as is (not compressed), entry names are file names without path
+*
+*   NOTE: Multi-byte values are stored little-endian, big-endian platforms are not supported
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef RESOURCE_PACK_H
+#define RESOURCE_PACK_H
+
+#include "raylib.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RESOURCE_PACK_VERSION       1       // Current resource pack version
+#define RESOURCE_PACK_NAME_SIZE     52      // Entry name size, including string terminator
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Resource pack header, stored at file start
+typedef struct ResourcePackHeader {
+    char id[4];                 // File identifier: "RPAK"
+    unsigned short version;     // File version (RESOURCE_PACK_VERSION)
+    unsigned short headerSize;  // Header size in bytes
+    unsigned int entryCount;    // Entries table count
+    unsigned int dataSize;      // Files data size, from file start (pack file size)
+} ResourcePackHeader;
+
+// Resource pack entry, one per packed file
+typedef struct ResourcePackEntry {
+    char name[RESOURCE_PACK_NAME_SIZE]; // File name, without path
+    unsigned int offset;        // File data offset from file start
+    unsigned int size;          // File data size in bytes
+    unsigned int reserved;      // Reserved for future versions
+} ResourcePackEntry;
+
+// Resource pack, loaded in memory
+// NOTE: Header and entries reference pack data, valid until pack is unloaded
+typedef struct ResourcePack {
+    unsigned char *data;                // Pack file data
+    int dataSize;                       // Pack file data size
+    const ResourcePackHeader *header;   // Pack header, NULL if pack is not valid
+    const ResourcePackEntry *entries;   // Entries table
+} ResourcePack;
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+ResourcePack LoadResourcePack(const char *fileName);        // Load resource pack, whole file read at once
+void UnloadResourcePack(ResourcePack pack);                 // Unload resource pack data
+bool IsResourcePackValid(ResourcePack pack);                // Check if resource pack is valid (loaded and entries consistent)
+const unsigned char *GetResourcePackFile(ResourcePack pack, const char *name, int *dataSize); // Get packed file data by name, NULL if not found
+bool ExportResourcePack(const char **fileNames, int fileCount, const char *fileName); // Export files to resource pack, entries named by file name
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RESOURCE_PACK_H